@@ -0,0 +1,121 @@
+#!/usr/bin/env node
+/**
+ * Local beacon collector for the dashboard's performance beacons.
+ *   npm run beacon [-- --port 9309]
+ *   REACT_APP_LATENCY_BEACON=http://localhost:9309/latency REACT_APP_VITALS_BEACON=http://localhost:9309/vitals npm start
+ * POST /latency  { client, ts, stages: { <stage>: { n, max, b: [index, count, ...] } } } (src/tickLatency.js)
+ * GET  /latency  merged p50 / p99 / p999 per stage across every client, in ms
+ *   Buckets use src/histogram.js's layout, so merged percentiles are as exact as a single client's.
+ * POST /vitals   { b: build, s: session, e: [[name, value, role, route], ...] } (src/vitals.js)
+ * GET  /vitals   p50 / p75 / p95 per build, role and route for each metric (CLS, LCP, FCP, TTFB, FID, INP, LTD)
+ *   The last MAX_SAMPLES values per group are kept; ?build= narrows it to one build.
+ * A summary is printed whenever new reports arrived in the last 10s.
+ */
+const http = require("http");
+
+const SUB_BITS = 6; // keep in step with src/histogram.js
+const SUB = 1 << SUB_BITS;
+const upperOf = (i) => {
+  if (i < SUB) return i;
+  const e = Math.floor(i / SUB) - 1;
+  return (SUB | i % SUB) * 2 ** e + 2 ** e - 1;
+};
+
+const argPort = process.argv.indexOf("--port");
+const port = argPort > 0 ? Number(process.argv[argPort + 1]) : 9309;
+
+const MAX_SAMPLES = 10000;
+
+const stages = new Map(); // stage -> { n, max, counts: Map<index, count> }
+const vitals = new Map(); // "build|role|route|metric" -> values, oldest first
+const clients = new Map(); // client -> last report ts
+let fresh = 0;
+
+function merge(report) {
+  clients.set(report.client, report.ts);
+  Object.entries(report.stages || {}).forEach(([name, d]) => {
+    if (!stages.has(name)) stages.set(name, { n: 0, max: 0, counts: new Map() });
+    const s = stages.get(name);
+    s.n += d.n;
+    s.max = Math.max(s.max, d.max);
+    for (let k = 0; k < d.b.length; k += 2) s.counts.set(d.b[k], (s.counts.get(d.b[k]) || 0) + d.b[k + 1]);
+  });
+  fresh++;
+}
+
+function addVitals(batch) {
+  (batch.e || []).forEach(([name, value, role, route]) => {
+    const key = [batch.b, role || "-", route || "-", name].join("|");
+    if (!vitals.has(key)) vitals.set(key, []);
+    const values = vitals.get(key);
+    values.push(value);
+    if (values.length > MAX_SAMPLES) values.shift();
+  });
+  fresh++;
+}
+
+// nearest-rank percentiles of the raw values
+function vitalsSummary(build) {
+  const out = [];
+  vitals.forEach((values, key) => {
+    const [b, role, route, metric] = key.split("|");
+    if (build && b !== build) return;
+    const sorted = values.slice().sort((x, y) => x - y);
+    const at = (q) => sorted[Math.max(1, Math.ceil(q * sorted.length)) - 1];
+    out.push({ build: b, role, route, metric, n: sorted.length, p50: at(0.5), p75: at(0.75), p95: at(0.95) });
+  });
+  return out.sort((x, y) => (x.build + x.route + x.role + x.metric).localeCompare(y.build + y.route + y.role + y.metric));
+}
+
+function summary() {
+  const out = {};
+  stages.forEach((s, name) => {
+    const idx = [...s.counts.keys()].sort((a, b) => a - b);
+    const ranks = [0.5, 0.99, 0.999].map((q) => Math.max(1, Math.ceil(q * s.n)));
+    const lat = [];
+    let seen = 0;
+    for (const i of idx) {
+      seen += s.counts.get(i);
+      while (lat.length < ranks.length && seen >= ranks[lat.length]) lat.push(Math.min(upperOf(i), s.max) / 1000);
+    }
+    out[name] = { n: s.n, p50: lat[0], p99: lat[1], p999: lat[2], max: s.max / 1000 };
+  });
+  return { clients: clients.size, stages: out };
+}
+
+http
+  .createServer((req, res) => {
+    res.setHeader("Access-Control-Allow-Origin", "*");
+    const url = new URL(req.url, "http://localhost");
+    const route = { "/latency": [merge, summary], "/vitals": [addVitals, () => vitalsSummary(url.searchParams.get("build"))] }[url.pathname];
+    if (!route) {
+      res.writeHead(404).end();
+      return;
+    }
+    if (req.method === "POST") {
+      let body = "";
+      req.on("data", (c) => (body += c));
+      req.on("end", () => {
+        try {
+          route[0](JSON.parse(body));
+          res.writeHead(204).end();
+        } catch (e) {
+          res.writeHead(400).end(e.message);
+        }
+      });
+      return;
+    }
+    res.writeHead(200, { "Content-Type": "application/json" }).end(JSON.stringify(route[1](), null, 2));
+  })
+  .listen(port, () => console.log(`beacon collector on http://localhost:${port} (/latency, /vitals)`));
+
+setInterval(() => {
+  if (!fresh) return;
+  fresh = 0;
+  const { clients: n, stages: s } = summary();
+  console.log(`${new Date().toISOString()} ${n} tick-latency clients, ${vitals.size} vitals groups`);
+  Object.entries(s).forEach(([name, v]) => console.log(`  ${name.padEnd(11)} p50 ${v.p50}ms  p99 ${v.p99}ms  p999 ${v.p999}ms  (n=${v.n})`));
+  vitalsSummary().forEach((v) =>
+    console.log(`  ${v.build} ${v.route} ${v.role} ${v.metric.padEnd(4)} p50 ${v.p50}  p75 ${v.p75}  p95 ${v.p95}  (n=${v.n})`)
+  );
+}, 10000);
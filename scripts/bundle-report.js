@@ -0,0 +1,66 @@
+#!/usr/bin/env node
+/**
+ * Bundle report per role.
+ *   npm run build -- --stats && npm run bundle:report
+ * Reads build/bundle-stats.json (webpack stats) and prints the JS bytes a user of each role
+ * downloads: the initial chunks plus every chunk in the role's lazy chunk groups
+ * (src/roleChunks.json). Exits non-zero if a Viewer would pull in ApexCharts.
+ */
+const fs = require("fs");
+const path = require("path");
+const zlib = require("zlib");
+
+const root = path.resolve(__dirname, "..");
+const build = path.join(root, "build");
+const statsFile = path.join(build, "bundle-stats.json");
+if (!fs.existsSync(statsFile)) {
+  console.error("build/bundle-stats.json not found – run `npm run build -- --stats` first");
+  process.exit(1);
+}
+const stats = JSON.parse(fs.readFileSync(statsFile, "utf8"));
+const roleChunks = require(path.join(root, "src/roleChunks.json"));
+
+const byId = new Map(stats.chunks.map((c) => [c.id, c]));
+const jsFiles = (chunk) => chunk.files.filter((f) => f.endsWith(".js"));
+const sizeOf = (file) => {
+  const buf = fs.readFileSync(path.join(build, file));
+  return { raw: buf.length, gzip: zlib.gzipSync(buf).length };
+};
+const kb = (n) => `${(n / 1024).toFixed(1)} kB`;
+
+const initial = stats.chunks.filter((c) => c.initial);
+const total = (chunks) => {
+  const files = new Set(chunks.flatMap(jsFiles));
+  let raw = 0;
+  let gzip = 0;
+  files.forEach((f) => {
+    const s = sizeOf(f);
+    raw += s.raw;
+    gzip += s.gzip;
+  });
+  return { raw, gzip, files };
+};
+// every chunk (own + shared vendor splits) the named group needs
+const groupChunks = (name) => {
+  const group = stats.namedChunkGroups[name];
+  if (!group) throw new Error(`chunk group "${name}" not in build – check webpackChunkName comments`);
+  return group.chunks.map((id) => byId.get(id));
+};
+const hasModule = (chunks, needle) => chunks.some((c) => (c.modules || []).some((m) => (m.name || "").includes(needle)));
+
+const init = total(initial);
+console.log(`initial JS: ${kb(init.raw)} (${kb(init.gzip)} gzip) in ${init.files.size} files`);
+
+let failed = false;
+Object.entries(roleChunks).forEach(([role, names]) => {
+  const chunks = [...initial, ...names.flatMap(groupChunks)];
+  const t = total(chunks);
+  const apex = hasModule(chunks, "node_modules/apexcharts");
+  console.log(`${role.padEnd(8)} ${kb(t.raw).padStart(10)} (${kb(t.gzip)} gzip)  apexcharts: ${apex ? "yes" : "no"}`);
+  if (role === "Viewer" && apex) failed = true;
+});
+
+if (failed) {
+  console.error("Viewer bundle includes ApexCharts");
+  process.exit(1);
+}
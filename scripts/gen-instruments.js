@@ -0,0 +1,167 @@
+#!/usr/bin/env node
+/**
+ * Writes a synthetic instrument universe to public/data/instruments.bin.
+ *   npm run gen:instruments [-- --count 120000]
+ * Layout (v2: string table, dictionaries, symbol hash) is documented in src/refdata.js – the
+ * reader is the source of truth.
+ */
+const fs = require("fs");
+const path = require("path");
+
+const args = process.argv.slice(2);
+const count = Number(args[args.indexOf("--count") + 1]) || 120000;
+const out = path.resolve(__dirname, "../public/data/instruments.bin");
+
+// deterministic so the file (and the IndexedDB cache key) is stable between runs
+let seed = 42;
+const rnd = () => ((seed = (seed * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+const pick = (a) => a[Math.floor(rnd() * a.length)];
+
+const KNOWN = [
+  ["AAPL", "Apple Inc.", "Technology"],
+  ["MSFT", "Microsoft Corp.", "Technology"],
+  ["GOOG", "Alphabet Inc.", "Communication"],
+  ["AMZN", "Amazon.com Inc.", "Consumer"],
+  ["TSLA", "Tesla Inc.", "Consumer"],
+  ["NVDA", "NVIDIA Corp.", "Technology"],
+  ["BTC", "Bitcoin", "Crypto"],
+  ["ETH", "Ethereum", "Crypto"],
+  ["FIN", "Finance", "Financials"],
+  ["HLTH", "Healthcare", "Health Care"],
+  ["ENG", "Energy", "Energy"],
+];
+const W1 = ["Alpha", "Blue", "Cedar", "Delta", "Evergreen", "First", "Granite", "Harbor", "Iron", "Juniper", "Keystone", "Liberty", "Meridian", "North", "Orion", "Pacific", "Quantum", "River", "Summit", "Titan", "United", "Vertex", "Western", "Zenith"];
+// second name word -> sector
+const W2 = {
+  Energy: "Energy",
+  Health: "Health Care",
+  Bio: "Health Care",
+  Capital: "Financials",
+  Financial: "Financials",
+  Software: "Technology",
+  Semiconductor: "Technology",
+  Logistics: "Industrials",
+  Retail: "Consumer",
+  Foods: "Consumer Staples",
+  Mining: "Materials",
+  Motors: "Consumer",
+  Pharma: "Health Care",
+  Networks: "Communication",
+  Realty: "Real Estate",
+  Media: "Communication",
+  Aerospace: "Industrials",
+  Utilities: "Utilities",
+  Robotics: "Technology",
+  Materials: "Materials",
+};
+const W3 = ["Inc.", "Corp.", "Holdings", "Group", "Ltd.", "PLC", "Trust", "Partners"];
+const CURRENCIES = [["USD", 0.8], ["EUR", 0.08], ["GBP", 0.05], ["JPY", 0.05], ["CHF", 0.02]];
+const currencyOf = () => {
+  let r = rnd();
+  for (const [c, p] of CURRENCIES) if ((r -= p) < 0) return c;
+  return "USD";
+};
+
+const rows = KNOWN.map(([sym, name, sector]) => ({ sym, name, sector, currency: "USD", tickSize: 0.01, lotSize: 1, liquidity: 5e9 + rnd() * 2e10, lastActive: 0 }));
+const seen = new Set(rows.map((r) => r.sym));
+const today = Math.floor(Date.now() / 86400000);
+while (rows.length < count) {
+  const len = 1 + Math.floor(rnd() * 5);
+  let sym = "";
+  for (let i = 0; i < len; i++) sym += String.fromCharCode(65 + Math.floor(rnd() * 26));
+  if (seen.has(sym)) continue;
+  seen.add(sym);
+  // log-normal-ish liquidity: a long tail of thinly traded names
+  const liquidity = Math.exp(10 + rnd() * 12);
+  const w2 = pick(Object.keys(W2));
+  const currency = currencyOf();
+  // yen names trade in 100-share lots on whole-yen ticks; sub-dollar names quote in 1/100 cent
+  const tickSize = currency === "JPY" ? 1 : liquidity < 1e5 ? 0.0001 : 0.01;
+  rows.push({ sym, name: `${pick(W1)} ${w2} ${pick(W3)}`, sector: W2[w2], currency, tickSize, lotSize: currency === "JPY" ? 100 : 1, liquidity, lastActive: today - Math.floor(rnd() * rnd() * 2000) });
+}
+rows.forEach((r) => {
+  if (!r.lastActive) r.lastActive = today;
+});
+
+// ---------- string table and dictionaries
+const strings = [];
+const stringIds = new Map();
+const intern = (s) => {
+  if (!stringIds.has(s)) {
+    stringIds.set(s, strings.length);
+    strings.push(s);
+  }
+  return stringIds.get(s);
+};
+const dictionary = (key) => {
+  const list = [...new Set(rows.map((r) => r[key]))];
+  if (list.length > 255) throw new Error(`too many ${key} values for a u8 code`);
+  return list;
+};
+const sectors = dictionary("sector");
+const currencies = dictionary("currency");
+const sectorNames = sectors.map(intern);
+const currencyNames = currencies.map(intern);
+const symbolIds = rows.map((r) => intern(r.sym));
+const nameIds = rows.map((r) => intern(r.name));
+const enc = new TextEncoder();
+const blobs = strings.map((s) => Buffer.from(enc.encode(s)));
+const strBytes = blobs.reduce((n, b) => n + b.length, 0);
+
+// ---------- symbol -> id hash (same FNV-1a as refdata.js hashSymbol)
+const hashSymbol = (sym) => {
+  let h = 0x811c9dc5;
+  for (let i = 0; i < sym.length; i++) h = Math.imul(h ^ sym.charCodeAt(i), 0x01000193);
+  return h >>> 0;
+};
+const n = rows.length;
+let slots = 1;
+while (slots < n * 2) slots *= 2;
+const hash = new Uint32Array(slots);
+rows.forEach((r, id) => {
+  let i = hashSymbol(r.sym) & (slots - 1);
+  while (hash[i]) i = (i + 1) & (slots - 1);
+  hash[i] = id + 1;
+});
+
+// ---------- write
+const align4 = (x) => (x + 3) & ~3;
+const size =
+  32 + 4 * (strings.length + 1) + 4 * (sectors.length + currencies.length) + 4 * n * 6 + 4 * slots + align4(n) * 2 + align4(strBytes);
+const buf = Buffer.alloc(size);
+buf.writeUInt32LE(0x4e495346, 0); // "FSIN"
+buf.writeUInt16LE(2, 4);
+buf.writeUInt32LE(n, 8);
+buf.writeUInt32LE(strings.length, 12);
+buf.writeUInt32LE(strBytes, 16);
+buf.writeUInt16LE(sectors.length, 20);
+buf.writeUInt16LE(currencies.length, 22);
+buf.writeUInt32LE(slots, 24);
+let off = 32;
+const u32s = (values) => values.forEach((v) => (off = buf.writeUInt32LE(v, off)));
+const f32s = (values) => values.forEach((v) => (off = buf.writeFloatLE(v, off)));
+const u8s = (values) => {
+  values.forEach((v) => (off = buf.writeUInt8(v, off)));
+  off = align4(off);
+};
+let acc = 0;
+u32s([0, ...blobs.map((b) => (acc += b.length))]);
+u32s(sectorNames);
+u32s(currencyNames);
+u32s(symbolIds);
+u32s(nameIds);
+f32s(rows.map((r) => r.tickSize));
+u32s(rows.map((r) => r.lotSize));
+f32s(rows.map((r) => r.liquidity));
+u32s(rows.map((r) => r.lastActive));
+u32s(hash);
+u8s(rows.map((r) => sectors.indexOf(r.sector)));
+u8s(rows.map((r) => currencies.indexOf(r.currency)));
+blobs.forEach((b) => {
+  b.copy(buf, off);
+  off += b.length;
+});
+
+fs.mkdirSync(path.dirname(out), { recursive: true });
+fs.writeFileSync(out, buf);
+console.log(`wrote ${n} instruments (${strings.length} distinct strings), ${(size / 1048576).toFixed(1)} MB -> ${path.relative(process.cwd(), out)}`);
@@ -0,0 +1,532 @@
+#include "gateway.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "net.hpp"
+#include "protocol.hpp"
+#include "ws.hpp"
+
+namespace fs {
+
+namespace {
+
+constexpr size_t kMaxHandshake = 8192;
+constexpr size_t kMaxClientFrame = 64 * 1024;
+constexpr int kMaxEvents = 512;
+constexpr uint64_t kSweepUs = 250000;  // slow-consumer policy check
+constexpr uint64_t kMetricsUs = 1000000;
+constexpr uint64_t kSnapshotUs = 10000;  // stats() freshness while the loop runs
+constexpr SymbolId kMetricsSlot = kNoSymbol - 1;  // metrics frames conflate like a symbol
+
+// tags for the non-connection fds in epoll_event.data.u64 (connections use their fd)
+constexpr uint64_t kTagBase = uint64_t(1) << 32;
+constexpr uint64_t kListenTag = kTagBase + 1;
+constexpr uint64_t kTimerTag = kTagBase + 2;
+constexpr uint64_t kUdpTag = kTagBase + 3;
+constexpr uint64_t kWakeTag = kTagBase + 4;
+
+bool add_fd(int ep, int fd, uint64_t tag, uint32_t events) {
+  epoll_event ev{};
+  ev.events = events;
+  ev.data.u64 = tag;
+  return epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+
+FramePtr text_frame(std::string_view payload) { return std::make_shared<const std::string>(encode_frame(Opcode::Text, payload)); }
+
+}  // namespace
+
+struct Gateway::Conn {
+  int fd = -1;
+  bool open = false;     // handshake done
+  bool closing = false;  // close after the queue drains
+  bool dirty = false;    // listed in dirty_
+  bool want_write = false;
+  bool doomed = false;  // over the hard cap; dropped at the next flush
+  bool metrics = false;
+  uint64_t blocked_since_us = 0;
+  uint64_t conflating_since_us = 0;
+  std::string in;
+  OutQueue out;
+};
+
+Gateway::Gateway(GatewayConfig cfg) : cfg_(cfg) {
+  ep_ = epoll_create1(EPOLL_CLOEXEC);
+  listen_fd_ = listen_tcp(cfg_.port, 4096);
+  wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (ep_ < 0 || listen_fd_ < 0 || wake_fd_ < 0) {
+    std::fprintf(stderr, "gateway: cannot listen on port %u: %s\n", unsigned(cfg_.port), std::strerror(errno));
+    if (listen_fd_ >= 0) close(listen_fd_);
+    listen_fd_ = -1;
+    return;
+  }
+  port_ = local_port(listen_fd_);
+  add_fd(ep_, listen_fd_, kListenTag, EPOLLIN);
+  add_fd(ep_, wake_fd_, kWakeTag, EPOLLIN);
+
+  for (const auto& name : default_symbols(cfg_.symbols)) table_.intern(name);
+  sim_price_.resize(table_.size());
+  for (size_t i = 0; i < sim_price_.size(); i++) sim_price_[i] = 50 + double((i * 7919) % 450);
+
+  if (cfg_.tick_rate > 0 && table_.size()) {
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    itimerspec its{};
+    its.it_interval.tv_sec = cfg_.tick_interval_ms / 1000;
+    its.it_interval.tv_nsec = long(cfg_.tick_interval_ms % 1000) * 1000000;
+    its.it_value = its.it_interval;
+    timerfd_settime(timer_fd_, 0, &its, nullptr);
+    add_fd(ep_, timer_fd_, kTimerTag, EPOLLIN);
+  }
+  if (cfg_.udp_port) {
+    udp_fd_ = bind_udp(cfg_.udp_port);
+    if (udp_fd_ >= 0) add_fd(ep_, udp_fd_, kUdpTag, EPOLLIN);
+    else std::fprintf(stderr, "gateway: cannot bind udp %u: %s\n", unsigned(cfg_.udp_port), std::strerror(errno));
+  }
+}
+
+Gateway::~Gateway() {
+  for (auto& c : conns_)
+    if (c) close(c->fd);
+  for (int fd : {listen_fd_, timer_fd_, udp_fd_, wake_fd_, ep_})
+    if (fd >= 0) close(fd);
+}
+
+void Gateway::stop() {
+  stopping_ = true;
+  uint64_t one = 1;
+  if (write(wake_fd_, &one, sizeof one) < 0) {
+    // the loop also checks stopping_ on every wakeup
+  }
+}
+
+GatewayStats Gateway::stats() const {
+  std::lock_guard<std::mutex> lock(snapshot_mu_);
+  // run() takes the lock before touching any state, so a stopped loop cannot start mid-collect()
+  return running_ ? snapshot_ : collect();
+}
+
+void Gateway::publish_snapshot() {
+  GatewayStats s = collect();
+  last_snapshot_us_ = mono_us();
+  std::lock_guard<std::mutex> lock(snapshot_mu_);
+  snapshot_ = s;
+}
+
+GatewayStats Gateway::collect() const {
+  GatewayStats s = stats_;
+  s.subscriptions = subs_.total();
+  for (const auto& c : conns_) {
+    if (!c) continue;
+    s.conflating += c->out.conflating();
+    s.queued_bytes += c->out.bytes();
+    if (c->out.bytes() > s.max_client_queue) s.max_client_queue = c->out.bytes();
+  }
+  return s;
+}
+
+void Gateway::run() {
+  epoll_event evs[kMaxEvents];
+  {
+    std::lock_guard<std::mutex> lock(snapshot_mu_);
+    snapshot_ = collect();
+    running_ = true;
+  }
+  last_stats_us_ = mono_us();
+  while (!stopping_) {
+    int n = epoll_wait(ep_, evs, kMaxEvents, dirty_.empty() ? int(kSweepUs / 1000) : 0);
+    if (n < 0 && errno != EINTR) break;
+    for (int i = 0; i < n; i++) {
+      uint64_t tag = evs[i].data.u64;
+      if (tag == kListenTag) on_accept();
+      else if (tag == kTimerTag) on_timer();
+      else if (tag == kUdpTag) on_udp();
+      else if (tag == kWakeTag) continue;
+      else {
+        int fd = int(tag);
+        if (size_t(fd) >= conns_.size() || !conns_[size_t(fd)]) continue;
+        Conn& c = *conns_[size_t(fd)];
+        if (evs[i].events & (EPOLLERR | EPOLLHUP)) {
+          close_conn(c);
+          continue;
+        }
+        if (evs[i].events & EPOLLOUT) on_writable(c);
+        if ((evs[i].events & EPOLLIN) && conns_[size_t(fd)]) on_readable(c);
+      }
+    }
+    flush_dirty();
+    if (batch_ingest_us_) {
+      uint64_t now = now_us();
+      fanout_.record(now > batch_ingest_us_ ? now - batch_ingest_us_ : 0);
+      batch_ingest_us_ = 0;
+    }
+    if (mono_us() - last_sweep_us_ >= kSweepUs) enforce_limits();
+    if (mono_us() - last_metrics_us_ >= kMetricsUs) publish_metrics();
+    if (cfg_.stats_interval_s > 0 && mono_us() - last_stats_us_ >= uint64_t(cfg_.stats_interval_s) * 1000000) print_stats();
+    if (mono_us() - last_snapshot_us_ >= kSnapshotUs) publish_snapshot();
+  }
+  {
+    std::lock_guard<std::mutex> lock(snapshot_mu_);
+    running_ = false;
+  }
+  stopping_ = false;  // run() may be entered again
+}
+
+// ---------- connections
+
+void Gateway::on_accept() {
+  for (;;) {
+    int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EMFILE || errno == ENFILE) std::fprintf(stderr, "gateway: out of file descriptors\n");
+      return;
+    }
+    if (stats_.clients >= cfg_.max_clients) {
+      stats_.rejected++;
+      close(fd);
+      continue;
+    }
+    set_nodelay(fd);
+    if (cfg_.sndbuf_bytes > 0) setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &cfg_.sndbuf_bytes, sizeof cfg_.sndbuf_bytes);
+    if (size_t(fd) >= conns_.size()) conns_.resize(size_t(fd) + 1);
+    auto c = std::make_unique<Conn>();
+    c->fd = fd;
+    conns_[size_t(fd)] = std::move(c);
+    add_fd(ep_, fd, uint64_t(fd), EPOLLIN | EPOLLRDHUP);
+    stats_.clients++;
+    stats_.accepted++;
+  }
+}
+
+void Gateway::watch(Conn& c, bool want_write) {
+  if (c.want_write == want_write) return;
+  c.want_write = want_write;
+  epoll_event ev{};
+  ev.events = EPOLLIN | EPOLLRDHUP | (want_write ? uint32_t(EPOLLOUT) : 0u);
+  ev.data.u64 = uint64_t(c.fd);
+  epoll_ctl(ep_, EPOLL_CTL_MOD, c.fd, &ev);
+}
+
+void Gateway::close_conn(Conn& c) {
+  int fd = c.fd;
+  subs_.remove_client(fd);
+  epoll_ctl(ep_, EPOLL_CTL_DEL, fd, nullptr);
+  close(fd);
+  stats_.clients--;
+  conns_[size_t(fd)].reset();  // c is gone; dirty_ entries are checked against conns_
+}
+
+void Gateway::on_readable(Conn& c) {
+  char buf[16384];
+  for (;;) {
+    ssize_t r = recv(c.fd, buf, sizeof buf, 0);
+    if (r > 0) {
+      c.in.append(buf, size_t(r));
+      if (size_t(r) < sizeof buf) break;
+      continue;
+    }
+    if (r < 0 && (errno == EAGAIN || errno == EINTR)) break;
+    close_conn(c);  // EOF or error
+    return;
+  }
+
+  if (!c.open) {
+    if (c.in.find("\r\n\r\n") == std::string::npos) {
+      if (c.in.size() > kMaxHandshake) close_conn(c);
+      return;
+    }
+    if (!handshake(c)) return;
+  }
+
+  size_t at = 0;
+  Frame f;
+  while (!c.closing) {
+    long used = parse_frame(reinterpret_cast<const uint8_t*>(c.in.data()) + at, c.in.size() - at, f, kMaxClientFrame);
+    if (used == 0) break;
+    if (used < 0) {
+      close_conn(c);
+      return;
+    }
+    at += size_t(used);
+    switch (f.op) {
+      case Opcode::Text: on_message(c, f.payload); break;
+      case Opcode::Ping: enqueue(c, std::make_shared<const std::string>(encode_frame(Opcode::Pong, f.payload))); break;
+      case Opcode::Close:
+        enqueue(c, std::make_shared<const std::string>(encode_frame(Opcode::Close, f.payload.substr(0, 2))));
+        c.closing = true;
+        subs_.remove_client(c.fd);
+        break;
+      default: break;  // pong, binary and continuation frames are ignored
+    }
+  }
+  c.in.erase(0, at);
+}
+
+bool Gateway::handshake(Conn& c) {
+  size_t end = c.in.find("\r\n\r\n");
+  std::string_view head(c.in.data(), end + 2);
+  std::string_view key = http_header(head, "Sec-WebSocket-Key");
+  if (head.substr(0, 4) != "GET " || key.empty()) {
+    static const std::string bad = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+    if (send(c.fd, bad.data(), bad.size(), MSG_NOSIGNAL) < 0) {
+      // closing anyway
+    }
+    close_conn(c);
+    return false;
+  }
+  std::string reply = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
+                      websocket_accept(key) + "\r\n\r\n";
+  enqueue(c, std::make_shared<const std::string>(std::move(reply)));
+  c.open = true;
+
+  // GET /?symbols=AAPL,MSFT subscribes right away
+  std::string_view target = head.substr(4, head.find(' ', 4) - 4);
+  size_t q = target.find("symbols=");
+  if (q != std::string_view::npos) {
+    std::string_view csv = target.substr(q + 8);
+    csv = csv.substr(0, csv.find('&'));
+    subscribe(c, split_symbols(csv), true);
+  }
+  c.metrics = target.find("metrics=1") != std::string_view::npos;
+  c.in.erase(0, end + 4);
+  return true;
+}
+
+void Gateway::on_message(Conn& c, const std::string& text) {
+  Command cmd;
+  if (!parse_command(text, cmd)) {
+    enqueue(c, text_frame("{\"t\":\"error\",\"message\":\"unknown command\"}"));
+    return;
+  }
+  if (cmd.op == Command::Metrics) c.metrics = cmd.on;
+  else subscribe(c, cmd.symbols, cmd.op == Command::Sub);
+}
+
+void Gateway::subscribe(Conn& c, const std::vector<std::string>& names, bool on) {
+  auto apply = [&](SymbolId sym) {
+    if (on) {
+      // a new subscriber gets the latest value straight away
+      if (subs_.subscribe(c.fd, sym) && sym < last_.size() && last_[sym]) enqueue_tick(c, sym, last_[sym]);
+    } else {
+      subs_.unsubscribe(c.fd, sym);
+    }
+  };
+  for (const auto& name : names) {
+    if (name == "*") {
+      for (SymbolId sym = 0; sym < table_.size(); sym++) apply(sym);
+      continue;
+    }
+    // only ingest interns: a client naming symbols must not grow the table (and every array sized by it)
+    SymbolId sym = table_.find(name);
+    if (sym != kNoSymbol) apply(sym);
+  }
+}
+
+// ---------- output
+
+void Gateway::enqueue(Conn& c, FramePtr f) {
+  c.out.push(std::move(f));
+  stats_.frames_queued++;
+  if (c.out.bytes() > cfg_.max_queue_bytes) c.doomed = true;  // can't close here: publish() may be iterating
+  if (!c.dirty) {
+    c.dirty = true;
+    dirty_.push_back(c.fd);
+  }
+}
+
+void Gateway::enqueue_tick(Conn& c, SymbolId sym, const FramePtr& f) {
+  if (!cfg_.conflate_bytes) {
+    enqueue(c, f);
+    return;
+  }
+  // a socket that would block already has a full kernel buffer of in-order ticks behind it
+  bool was = c.out.conflating();
+  if (c.out.push_tick(sym, f, c.want_write ? 0 : cfg_.conflate_bytes)) stats_.conflated++;
+  stats_.frames_queued++;
+  if (!was && c.out.conflating()) {
+    stats_.conflation_starts++;
+    c.conflating_since_us = mono_us();
+  }
+  if (!c.dirty) {
+    c.dirty = true;
+    dirty_.push_back(c.fd);
+  }
+}
+
+void Gateway::flush_dirty() {
+  // flushing never queues more output, so dirty_ is stable while we walk it
+  for (int fd : dirty_) {
+    Conn* c = conns_[size_t(fd)].get();
+    if (!c || !c->dirty) continue;  // closed meanwhile (or fd reused and already handled)
+    c->dirty = false;
+    if (c->doomed) drop(*c, stats_.dropped_overflow);
+    else if (!c->want_write) flush(*c);  // otherwise EPOLLOUT will tell us when there is room
+  }
+  dirty_.clear();
+}
+
+void Gateway::flush(Conn& c) {
+  iovec iov[OutQueue::kMaxIov];
+  while (!c.out.empty()) {
+    int n = c.out.gather(iov);
+    ssize_t w = writev(c.fd, iov, n);
+    stats_.writev_calls++;
+    if (w < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN) {
+        stats_.would_block++;
+        if (!c.blocked_since_us) c.blocked_since_us = mono_us();
+        watch(c, true);
+        return;
+      }
+      close_conn(c);
+      return;
+    }
+    stats_.bytes_written += uint64_t(w);
+    c.out.consume(size_t(w));
+    c.blocked_since_us = 0;
+  }
+  c.conflating_since_us = 0;  // fully drained, so no longer behind
+  watch(c, false);
+  if (c.closing) close_conn(c);
+}
+
+void Gateway::on_writable(Conn& c) { flush(c); }  // disarms EPOLLOUT once drained
+
+// ---------- slow consumers
+// A client may conflate for a while (a busy tab catching up); one that stops reading entirely, or
+// never catches up, is dropped so its socket and queue stop costing anything.
+
+void Gateway::drop(Conn& c, uint64_t& reason) {
+  reason++;
+  close_conn(c);
+}
+
+void Gateway::enforce_limits() {
+  uint64_t now = mono_us();
+  last_sweep_us_ = now;
+  uint64_t stall = uint64_t(cfg_.stall_timeout_ms) * 1000;
+  uint64_t lag = uint64_t(cfg_.max_conflation_ms) * 1000;
+  for (auto& slot : conns_) {
+    if (!slot) continue;
+    Conn& c = *slot;
+    if (c.doomed) drop(c, stats_.dropped_overflow);
+    else if (stall && c.blocked_since_us && now - c.blocked_since_us > stall) drop(c, stats_.dropped_stalled);
+    else if (lag && c.conflating_since_us && now - c.conflating_since_us > lag) drop(c, stats_.dropped_lagging);
+  }
+}
+
+// ---------- metrics
+
+void Gateway::publish_metrics() {
+  uint64_t now = mono_us();
+  double secs = last_metrics_us_ ? double(now - last_metrics_us_) / 1e6 : 1;
+  last_metrics_us_ = now;
+  stats_.latency_p50 = fanout_.percentile(0.5);
+  stats_.latency_p99 = fanout_.percentile(0.99);
+  stats_.latency_p999 = fanout_.percentile(0.999);
+  fanout_.reset();
+
+  GatewayStats s = collect();
+  const GatewayStats& p = at_last_metrics_;
+  MetricsSample m;
+  m.ts_ms = now_us() / 1000;
+  m.clients = s.clients;
+  m.ticks_per_s = uint64_t(double(s.ticks - p.ticks) / secs + 0.5);
+  m.frames_per_s = uint64_t(double(s.frames_queued - p.frames_queued) / secs + 0.5);
+  m.p50_us = s.latency_p50;
+  m.p99_us = s.latency_p99;
+  m.p999_us = s.latency_p999;
+  m.conflating = s.conflating;
+  m.conflated_per_s = uint64_t(double(s.conflated - p.conflated) / secs + 0.5);
+  m.dropped = s.dropped_stalled + s.dropped_lagging + s.dropped_overflow;
+  m.queued_bytes = s.queued_bytes;
+  at_last_metrics_ = s;
+
+  FramePtr f;
+  for (auto& c : conns_) {
+    if (!c || !c->metrics || !c->open || c->closing) continue;
+    if (!f) f = text_frame(encode_metrics(m));  // encoded once, only if someone listens
+    enqueue_tick(*c, kMetricsSlot, f);
+  }
+}
+
+// ---------- tick sources
+
+void Gateway::publish(SymbolId sym, double price, uint64_t ingest_us) {
+  stats_.ticks++;
+  if (!batch_ingest_us_ || ingest_us < batch_ingest_us_) batch_ingest_us_ = ingest_us;
+  FramePtr f = text_frame(encode_tick(table_.name(sym), price, ingest_us / 1000, ingest_us, ++seq_));
+  if (sym >= last_.size()) last_.resize(size_t(sym) + 1);
+  last_[sym] = f;
+  for (int fd : subs_.subscribers(sym)) enqueue_tick(*conns_[size_t(fd)], sym, f);
+}
+
+void Gateway::on_timer() {
+  uint64_t expirations = 0;
+  if (read(timer_fd_, &expirations, sizeof expirations) != sizeof expirations) return;
+  // a late wakeup publishes the ticks it missed, so the rate holds under load
+  sim_carry_ += cfg_.tick_rate * cfg_.tick_interval_ms / 1000.0 * double(expirations);
+  auto n = size_t(sim_carry_);
+  sim_carry_ -= double(n);
+  uint64_t ts = now_us();
+  for (size_t i = 0; i < n; i++) {
+    rng_ ^= rng_ << 13, rng_ ^= rng_ >> 7, rng_ ^= rng_ << 17;
+    auto sym = SymbolId(rng_ % sim_price_.size());
+    double step = (double(rng_ >> 11 & 0xFFFF) / 65535.0 - 0.5) * 0.002;
+    sim_price_[sym] = std::fmax(0.01, sim_price_[sym] * (1 + step));
+    publish(sym, sim_price_[sym], ts);
+  }
+}
+
+void Gateway::on_udp() {
+  char buf[65536];
+  for (;;) {
+    ssize_t r = recv(udp_fd_, buf, sizeof buf - 1, 0);
+    if (r <= 0) return;
+    uint64_t ts = now_us();
+    std::string_view data(buf, size_t(r));
+    while (!data.empty()) {
+      size_t nl = data.find('\n');
+      std::string_view line = data.substr(0, nl);
+      size_t sp = line.find(' ');
+      if (sp != std::string_view::npos && sp > 0) {
+        std::string num(line.substr(sp + 1));
+        char* end = nullptr;
+        double price = std::strtod(num.c_str(), &end);
+        if (end != num.c_str() && price > 0) publish(table_.intern(line.substr(0, sp)), price, ts);
+      }
+      if (nl == std::string_view::npos) break;
+      data.remove_prefix(nl + 1);
+    }
+  }
+}
+
+void Gateway::print_stats() {
+  uint64_t now = mono_us();
+  double secs = double(now - last_stats_us_) / 1e6;
+  const GatewayStats& p = stats_at_last_print_;
+  GatewayStats s = collect();
+  std::fprintf(stderr,
+               "gateway: clients=%llu subs=%llu ticks/s=%.0f frames/s=%.0f MB/s=%.1f writev/s=%.0f eagain/s=%.0f "
+               "conflating=%llu conflated/s=%.0f queued=%lluKB maxq=%lluKB dropped=%llu/%llu/%llu p99=%lluus\n",
+               (unsigned long long)s.clients, (unsigned long long)s.subscriptions, double(s.ticks - p.ticks) / secs,
+               double(s.frames_queued - p.frames_queued) / secs, double(s.bytes_written - p.bytes_written) / secs / 1e6,
+               double(s.writev_calls - p.writev_calls) / secs, double(s.would_block - p.would_block) / secs,
+               (unsigned long long)s.conflating, double(s.conflated - p.conflated) / secs, (unsigned long long)s.queued_bytes / 1024,
+               (unsigned long long)s.max_client_queue / 1024, (unsigned long long)s.dropped_stalled,
+               (unsigned long long)s.dropped_lagging, (unsigned long long)s.dropped_overflow, (unsigned long long)s.latency_p99);
+  stats_at_last_print_ = stats_;
+  last_stats_us_ = now;
+}
+
+}  // namespace fs
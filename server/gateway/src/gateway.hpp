@@ -0,0 +1,144 @@
+#pragma once
+// Market-data WebSocket gateway: one epoll loop owns every socket.
+// - Ticks come from the built-in simulator (timerfd) and/or UDP lines "SYM PRICE\n"
+// - Each tick is encoded into a frame once and queued by reference on every subscriber
+// - Queues with new data are flushed once per loop iteration with writev(); a socket that
+//   would block waits for EPOLLOUT instead of being retried
+// - A client that falls behind is conflated to the latest tick per symbol (see OutQueue) and is
+//   disconnected if it stays stalled or conflated for too long, so it never delays anyone else
+// - Once a second, clients that asked for metrics get one compact frame (see protocol.hpp)
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "histogram.hpp"
+#include "out_queue.hpp"
+#include "subscriptions.hpp"
+
+namespace fs {
+
+struct GatewayConfig {
+  uint16_t port = 8765;
+  uint16_t udp_port = 0;     // 0 = no UDP ingest
+  size_t symbols = 100;      // simulated universe (see default_symbols)
+  double tick_rate = 2000;   // simulated ticks per second across all symbols; 0 = off
+  int tick_interval_ms = 10;
+  size_t max_clients = 16000;
+  int stats_interval_s = 0;  // periodic stderr line; 0 = off
+
+  // slow consumers
+  int sndbuf_bytes = 16 * 1024;        // per-socket kernel send buffer (stale data a slow client can hold); 0 = autotune
+  size_t conflate_bytes = 64 * 1024;   // backlog at which ticks conflate (immediately once the socket blocks); 0 = never
+  size_t max_queue_bytes = 1 << 20;    // hard cap (control frames only grow past conflation)
+  int stall_timeout_ms = 10000;        // disconnect after this long without write progress; 0 = never
+  int max_conflation_ms = 30000;       // disconnect after conflating continuously this long; 0 = never
+};
+
+struct GatewayStats {
+  uint64_t clients = 0;
+  uint64_t accepted = 0;
+  uint64_t rejected = 0;
+  uint64_t ticks = 0;
+  uint64_t frames_queued = 0;
+  uint64_t bytes_written = 0;
+  uint64_t writev_calls = 0;
+  uint64_t would_block = 0;
+  uint64_t subscriptions = 0;
+  // slow consumers
+  uint64_t conflating = 0;        // clients conflating right now
+  uint64_t conflation_starts = 0;
+  uint64_t conflated = 0;         // ticks replaced by a newer one before being written
+  uint64_t queued_bytes = 0;      // current backlog over all clients
+  uint64_t max_client_queue = 0;  // largest current backlog
+  uint64_t dropped_stalled = 0;
+  uint64_t dropped_lagging = 0;
+  uint64_t dropped_overflow = 0;
+  // fan-out latency (ingest -> written) over the last metrics second, µs
+  uint64_t latency_p50 = 0;
+  uint64_t latency_p99 = 0;
+  uint64_t latency_p999 = 0;
+};
+
+class Gateway {
+ public:
+  explicit Gateway(GatewayConfig cfg);
+  ~Gateway();
+  Gateway(const Gateway&) = delete;
+  Gateway& operator=(const Gateway&) = delete;
+
+  bool ok() const { return listen_fd_ >= 0; }
+  uint16_t port() const { return port_; }
+
+  // Runs the event loop until stop() (callable from any thread); may be called again afterwards.
+  void run();
+  void stop();
+
+  // Fan-out entry point for every tick source
+  void publish(SymbolId sym, double price, uint64_t ingest_us);
+
+  SymbolTable& symbols() { return table_; }
+  // Safe from any thread: while run() is active this is the snapshot the loop publishes every
+  // few ms; while it is stopped, the current counters.
+  GatewayStats stats() const;
+
+ private:
+  struct Conn;
+
+  void on_accept();
+  void on_timer();
+  void on_udp();
+  void on_readable(Conn& c);
+  void on_writable(Conn& c);
+  bool handshake(Conn& c);
+  void on_message(Conn& c, const std::string& text);
+  void subscribe(Conn& c, const std::vector<std::string>& names, bool on);
+  void enqueue(Conn& c, FramePtr f);
+  void enqueue_tick(Conn& c, SymbolId sym, const FramePtr& f);
+  void flush(Conn& c);
+  void flush_dirty();
+  void close_conn(Conn& c);
+  void watch(Conn& c, bool want_write);
+  void enforce_limits();
+  void publish_metrics();
+  void drop(Conn& c, uint64_t& reason);
+  void print_stats();
+  GatewayStats collect() const;  // loop thread (or stopped)
+  void publish_snapshot();
+
+  GatewayConfig cfg_;
+  int ep_ = -1;
+  int listen_fd_ = -1;
+  int timer_fd_ = -1;
+  int udp_fd_ = -1;
+  int wake_fd_ = -1;
+  uint16_t port_ = 0;
+  std::atomic<bool> stopping_{false};
+
+  SymbolTable table_;
+  Subscriptions subs_;
+  std::vector<std::unique_ptr<Conn>> conns_;  // indexed by fd
+  std::vector<int> dirty_;                    // fds with newly queued frames
+  std::vector<FramePtr> last_;                // last tick frame per symbol (sent on subscribe)
+  std::vector<double> sim_price_;
+  double sim_carry_ = 0;
+  uint64_t rng_ = 0x9E3779B97F4A7C15ull;
+  uint64_t seq_ = 0;
+  uint64_t last_stats_us_ = 0;
+  uint64_t last_sweep_us_ = 0;
+  uint64_t last_metrics_us_ = 0;
+  uint64_t batch_ingest_us_ = 0;  // oldest tick published since the last flush
+  Histogram fanout_;              // current second
+  GatewayStats at_last_metrics_;
+  GatewayStats stats_;
+  GatewayStats stats_at_last_print_;
+  mutable std::mutex snapshot_mu_;  // guards running_ and snapshot_
+  bool running_ = false;
+  GatewayStats snapshot_;
+  uint64_t last_snapshot_us_ = 0;
+};
+
+}  // namespace fs
@@ -0,0 +1,78 @@
+#pragma once
+// Log-linear latency histogram (HDR-style): 2^kSubBits linear sub-buckets per power of two,
+// so any recorded value is reported within 1/2^kSubBits (< 1%) of its true value.
+// Fixed memory, O(1) record, mergeable.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace fs {
+
+class Histogram {
+ public:
+  static constexpr int kSubBits = 7;
+  static constexpr int kSub = 1 << kSubBits;
+  static constexpr int kMaxExp = 40;  // rows; values up to ~2^47 (µs: years)
+
+  Histogram() : counts_((kMaxExp + 1) * kSub, 0) {}
+
+  void record(uint64_t v) {
+    counts_[index(v)]++;
+    total_++;
+    if (v > max_) max_ = v;
+  }
+
+  void merge(const Histogram& o) {
+    for (size_t i = 0; i < counts_.size(); i++) counts_[i] += o.counts_[i];
+    total_ += o.total_;
+    if (o.max_ > max_) max_ = o.max_;
+  }
+
+  void reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    total_ = 0;
+    max_ = 0;
+  }
+
+  // q in [0, 1]; returns the upper edge of the bucket holding that rank (0 when empty)
+  uint64_t percentile(double q) const {
+    if (!total_) return 0;
+    uint64_t rank = uint64_t(std::ceil(q * double(total_)));  // nearest rank
+    if (rank < 1) rank = 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+      seen += counts_[i];
+      if (seen >= rank) {
+        uint64_t hi = upper(i);
+        return hi < max_ ? hi : max_;
+      }
+    }
+    return max_;
+  }
+
+  uint64_t count() const { return total_; }
+  uint64_t max() const { return max_; }
+
+ private:
+  // bucket 0..kSub-1 hold exact small values; above that, row e+1 covers [kSub << e, kSub << (e+1))
+  static size_t index(uint64_t v) {
+    if (v < uint64_t(kSub)) return size_t(v);
+    int e = 63 - __builtin_clzll(v) - kSubBits;
+    if (e >= kMaxExp) return size_t(kMaxExp) * kSub + kSub - 1;
+    return size_t(e + 1) * kSub + size_t((v >> e) & (kSub - 1));
+  }
+  // largest value that maps to bucket i
+  static uint64_t upper(size_t i) {
+    if (i < size_t(kSub)) return i;
+    uint64_t e = i / kSub - 1;
+    return ((uint64_t(kSub) | (i % kSub)) << e) + ((uint64_t(1) << e) - 1);
+  }
+
+  std::vector<uint64_t> counts_;
+  uint64_t total_ = 0;
+  uint64_t max_ = 0;
+};
+
+}  // namespace fs
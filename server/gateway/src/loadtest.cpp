@@ -0,0 +1,329 @@
+// fs_loadtest: opens N WebSocket clients against fs_gateway and reports fan-out latency
+// (gateway ingest stamp -> frame parsed here) once every client is connected and warmed up.
+//   fs_loadtest [--host 127.0.0.1] [--port 8765] [--clients 10000] [--subs 5] [--symbols 100]
+//               [--warmup 2] [--duration 10] [--slow-pct 0] [--slow-bps 100] [--slow-subs N] [--json]
+// Slow clients (--slow-pct of them, spread evenly) keep a small receive buffer and read only
+// --slow-bps bytes per second (optionally subscribed to --slow-subs symbols), so the gateway sees
+// them fall behind; their latency is reported separately from everyone else's.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "histogram.hpp"
+#include "net.hpp"
+#include "protocol.hpp"
+#include "ws.hpp"
+
+namespace {
+
+struct Options {
+  std::string host = "127.0.0.1";
+  uint16_t port = 8765;
+  size_t clients = 10000;
+  size_t subs = 5;
+  size_t symbols = 100;
+  double warmup_s = 2;
+  double duration_s = 10;
+  double slow_pct = 0;
+  size_t slow_bps = 100;
+  size_t slow_subs = 0;  // 0 = same as subs
+  bool json = false;
+};
+
+enum class State { Connecting, Handshake, Open, Dead };
+
+struct Client {
+  int fd = -1;
+  State state = State::Connecting;
+  bool slow = false;
+  std::string request;
+  std::string in;
+  uint64_t msgs = 0;
+};
+
+bool parse_args(int argc, char** argv, Options& o) {
+  for (int i = 1; i < argc; i++) {
+    std::string k = argv[i];
+    if (k == "--json") {
+      o.json = true;
+      continue;
+    }
+    if (i + 1 >= argc) return false;
+    const char* v = argv[++i];
+    if (k == "--host") o.host = v;
+    else if (k == "--port") o.port = uint16_t(std::atoi(v));
+    else if (k == "--clients") o.clients = size_t(std::atol(v));
+    else if (k == "--subs") o.subs = size_t(std::atol(v));
+    else if (k == "--symbols") o.symbols = size_t(std::atol(v));
+    else if (k == "--warmup") o.warmup_s = std::atof(v);
+    else if (k == "--duration") o.duration_s = std::atof(v);
+    else if (k == "--slow-pct") o.slow_pct = std::atof(v);
+    else if (k == "--slow-bps") o.slow_bps = size_t(std::atol(v));
+    else if (k == "--slow-subs") o.slow_subs = size_t(std::atol(v));
+    else return false;
+  }
+  return o.clients > 0 && o.symbols > 0;
+}
+
+class LoadTest {
+ public:
+  explicit LoadTest(Options o) : o_(std::move(o)), names_(fs::default_symbols(o_.symbols)) {}
+
+  int run() {
+    ep_ = epoll_create1(EPOLL_CLOEXEC);
+    clients_.resize(o_.clients);
+    if (o_.slow_pct > 0) {
+      auto every = size_t(100 / o_.slow_pct + 0.5);
+      for (size_t i = 0; i < clients_.size(); i += every ? every : 1) clients_[i].slow = true;
+    }
+    uint64_t next_drain = 0;
+    uint64_t start = fs::mono_us();
+    uint64_t measure_at = 0, end_at = 0;
+    epoll_event evs[1024];
+
+    while (!end_at || fs::mono_us() < end_at) {
+      // ramp: keep a bounded number of handshakes in flight so the listen backlog never overflows
+      while (next_ < clients_.size() && pending_ < 256) open_client(next_++);
+      if (!measure_at && next_ == clients_.size() && pending_ == 0) {
+        connected_at_ = fs::mono_us();
+        measure_at = connected_at_ + uint64_t(o_.warmup_s * 1e6);
+        end_at = measure_at + uint64_t(o_.duration_s * 1e6);
+        if (!o_.json) std::fprintf(stderr, "loadtest: %zu/%zu clients open after %.2fs\n", open_, clients_.size(), double(connected_at_ - start) / 1e6);
+      }
+      if (measure_at && !measuring_ && fs::mono_us() >= measure_at) {
+        measuring_ = true;
+        measure_from_us_ = fs::now_us();
+        measure_start_mono_ = fs::mono_us();
+      }
+
+      int n = epoll_wait(ep_, evs, 1024, 10);
+      for (int i = 0; i < n; i++) on_event(clients_[evs[i].data.u64], evs[i].events);
+      if (fs::mono_us() >= next_drain) {
+        next_drain = fs::mono_us() + 100000;
+        for (auto& c : clients_)
+          if (c.slow && c.state == State::Open) drain_slow(c, o_.slow_bps / 10);
+      }
+    }
+    double secs = double(fs::mono_us() - measure_start_mono_) / 1e6;
+    report(secs);
+    for (auto& c : clients_)
+      if (c.fd >= 0) close(c.fd);
+    close(ep_);
+    return open_ ? 0 : 1;
+  }
+
+ private:
+  void open_client(size_t i) {
+    Client& c = clients_[i];
+    c.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (c.fd < 0) {
+      fail(c);
+      return;
+    }
+    fs::set_nodelay(c.fd);
+    if (c.slow) {
+      int rcvbuf = 4096;
+      setsockopt(c.fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof rcvbuf);
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(o_.port);
+    inet_pton(AF_INET, o_.host.c_str(), &addr.sin_addr);
+    int r = connect(c.fd, reinterpret_cast<sockaddr*>(&addr), sizeof addr);
+    if (r < 0 && errno != EINPROGRESS) {
+      fail(c);
+      return;
+    }
+    // each client subscribes to `subs` distinct symbols, spread evenly over the universe
+    std::string path = "/?symbols=";
+    size_t subs = c.slow && o_.slow_subs ? o_.slow_subs : o_.subs;
+    for (size_t k = 0; k < subs && k < names_.size(); k++) {
+      if (k) path += ',';
+      path += names_[(i * 7 + k * (subs < names_.size() ? 13 : 1)) % names_.size()];
+    }
+    c.request = "GET " + path + " HTTP/1.1\r\nHost: " + o_.host + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n" +
+                "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLOUT;
+    ev.data.u64 = i;
+    epoll_ctl(ep_, EPOLL_CTL_ADD, c.fd, &ev);
+    pending_++;
+  }
+
+  void fail(Client& c) {
+    if (c.state == State::Connecting || c.state == State::Handshake) pending_--, failed_++;
+    if (c.state == State::Open) open_--, (c.slow ? dropped_slow_ : dropped_)++;
+    if (c.fd >= 0) close(c.fd);
+    c.fd = -1;
+    c.state = State::Dead;
+  }
+
+  void on_event(Client& c, uint32_t events) {
+    if (c.state == State::Dead) return;
+    if (events & (EPOLLERR | EPOLLHUP)) {
+      fail(c);
+      return;
+    }
+    if (c.state == State::Connecting && (events & EPOLLOUT)) {
+      if (send(c.fd, c.request.data(), c.request.size(), MSG_NOSIGNAL) != ssize_t(c.request.size())) {
+        fail(c);
+        return;
+      }
+      c.state = State::Handshake;
+      epoll_event ev{};
+      ev.events = EPOLLIN;
+      ev.data.u64 = size_t(&c - clients_.data());
+      epoll_ctl(ep_, EPOLL_CTL_MOD, c.fd, &ev);
+    }
+    if (events & EPOLLIN) on_readable(c);
+  }
+
+  void on_readable(Client& c) {
+    char buf[65536];
+    for (;;) {
+      ssize_t r = recv(c.fd, buf, sizeof buf, 0);
+      if (r > 0) {
+        c.in.append(buf, size_t(r));
+        if (size_t(r) < sizeof buf) break;
+        continue;
+      }
+      if (r < 0 && (errno == EAGAIN || errno == EINTR)) break;
+      fail(c);
+      return;
+    }
+    if (c.state == State::Handshake) {
+      size_t end = c.in.find("\r\n\r\n");
+      if (end == std::string::npos) return;
+      if (c.in.compare(0, 12, "HTTP/1.1 101") != 0) {
+        fail(c);
+        return;
+      }
+      c.in.erase(0, end + 4);
+      c.state = State::Open;
+      pending_--;
+      open_++;
+      if (c.slow) {
+        // from here on only drain_slow() reads this socket
+        epoll_event ev{};
+        ev.data.u64 = size_t(&c - clients_.data());
+        epoll_ctl(ep_, EPOLL_CTL_MOD, c.fd, &ev);
+      }
+    }
+    parse(c);
+  }
+
+  void drain_slow(Client& c, size_t budget) {
+    char buf[65536];
+    ssize_t r = recv(c.fd, buf, budget < sizeof buf ? budget : sizeof buf, 0);
+    if (r == 0 || (r < 0 && errno != EAGAIN && errno != EINTR)) {
+      fail(c);  // dropped by the gateway
+      return;
+    }
+    if (r > 0) {
+      c.in.append(buf, size_t(r));
+      parse(c);
+    }
+  }
+
+  void parse(Client& c) {
+    // server frames are unmasked, so payloads are read in place; one clock read per batch
+    uint64_t now = measuring_ ? fs::now_us() : 0;
+    size_t at = 0;
+    fs::FrameView f;
+    for (;;) {
+      long used = fs::peek_frame(reinterpret_cast<const uint8_t*>(c.in.data()) + at, c.in.size() - at, f, 1 << 20);
+      if (used <= 0) break;
+      if (f.op == fs::Opcode::Text && now) on_tick(c, std::string_view(c.in.data() + at + f.offset, f.length), now);
+      at += size_t(used);
+    }
+    c.in.erase(0, at);
+  }
+
+  void on_tick(Client& c, std::string_view payload, uint64_t now) {
+    uint64_t ingest = fs::json_uint(payload, "us", 0);
+    if (ingest < measure_from_us_) return;  // published before the window (or a subscribe snapshot)
+    (c.slow ? slow_latency_ : latency_).record(now > ingest ? now - ingest : 0);
+    c.msgs++;
+  }
+
+  static std::string json_latency(const fs::Histogram& h) {
+    char buf[200];
+    std::snprintf(buf, sizeof buf, "{\"count\":%llu,\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu}",
+                  (unsigned long long)h.count(), (unsigned long long)h.percentile(0.5), (unsigned long long)h.percentile(0.9),
+                  (unsigned long long)h.percentile(0.99), (unsigned long long)h.percentile(0.999), (unsigned long long)h.max());
+    return buf;
+  }
+
+  static void print_latency(const char* label, const fs::Histogram& h) {
+    std::printf("%-8s p50 %lluus  p90 %lluus  p99 %lluus  p99.9 %lluus  max %lluus  (%llu msgs)\n", label,
+                (unsigned long long)h.percentile(0.5), (unsigned long long)h.percentile(0.9), (unsigned long long)h.percentile(0.99),
+                (unsigned long long)h.percentile(0.999), (unsigned long long)h.max(), (unsigned long long)h.count());
+  }
+
+  void report(double secs) {
+    size_t slow = 0;
+    for (const auto& c : clients_) slow += c.slow;
+    uint64_t msgs = latency_.count() + slow_latency_.count();
+    double rate = secs > 0 ? double(msgs) / secs : 0;
+    if (o_.json) {
+      std::printf("{\"clients\":%zu,\"slow\":%zu,\"open\":%zu,\"failed\":%zu,\"dropped\":%zu,\"droppedSlow\":%zu,\"subs\":%zu,"
+                  "\"seconds\":%.2f,\"msgs\":%llu,\"msgsPerSec\":%.0f,\"latencyUs\":%s,\"slowLatencyUs\":%s}\n",
+                  clients_.size(), slow, open_, failed_, dropped_, dropped_slow_, o_.subs, secs, (unsigned long long)msgs, rate,
+                  json_latency(latency_).c_str(), json_latency(slow_latency_).c_str());
+      return;
+    }
+    std::printf("clients  %zu open, %zu failed to connect, %zu dropped (%zu of %zu slow), %zu subs each\n", open_, failed_,
+                dropped_ + dropped_slow_, dropped_slow_, slow, o_.subs);
+    std::printf("messages %llu in %.1fs (%.0f msg/s)\n", (unsigned long long)msgs, secs, rate);
+    print_latency("latency", latency_);
+    if (slow) print_latency("slow", slow_latency_);
+  }
+
+  Options o_;
+  std::vector<std::string> names_;
+  std::vector<Client> clients_;
+  int ep_ = -1;
+  size_t next_ = 0;
+  size_t pending_ = 0;
+  size_t open_ = 0;
+  size_t failed_ = 0;
+  size_t dropped_ = 0;
+  size_t dropped_slow_ = 0;
+  bool measuring_ = false;
+  uint64_t measure_from_us_ = 0;
+  uint64_t measure_start_mono_ = 0;
+  uint64_t connected_at_ = 0;
+  fs::Histogram latency_;       // clients that keep up
+  fs::Histogram slow_latency_;  // the deliberately slow ones
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options o;
+  if (!parse_args(argc, argv, o)) {
+    std::fprintf(stderr,
+                 "usage: %s [--host H] [--port N] [--clients N] [--subs N] [--symbols N] [--warmup s] [--duration s]\n"
+                 "          [--slow-pct P] [--slow-bps N] [--slow-subs N] [--json]\n",
+                 argv[0]);
+    return 2;
+  }
+  long fds = fs::raise_fd_limit();
+  if (fds > 0 && size_t(fds) < o.clients + 16) {
+    std::fprintf(stderr, "loadtest: fd limit %ld is below %zu clients\n", fds, o.clients);
+    return 1;
+  }
+  std::signal(SIGPIPE, SIG_IGN);
+  return LoadTest(o).run();
+}
@@ -0,0 +1,59 @@
+// fs_gateway: market-data WebSocket gateway for the dashboard's price feed.
+//   fs_gateway [--port 8765] [--udp PORT] [--symbols 100] [--rate 2000] [--tick-ms 10] [--max-clients 16000] [--stats 5]
+//              [--sndbuf-kb 16] [--conflate-kb 64 (0 = unbounded FIFO)] [--max-queue-kb 1024]
+//              [--stall-ms 10000] [--max-conflation-ms 30000]
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "gateway.hpp"
+#include "net.hpp"
+
+static fs::Gateway* g_gateway = nullptr;
+
+static void on_signal(int) {
+  if (g_gateway) g_gateway->stop();
+}
+
+int main(int argc, char** argv) {
+  fs::GatewayConfig cfg;
+  cfg.stats_interval_s = 5;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const char* k = argv[i];
+    const char* v = argv[i + 1];
+    if (!std::strcmp(k, "--port")) cfg.port = uint16_t(std::atoi(v));
+    else if (!std::strcmp(k, "--udp")) cfg.udp_port = uint16_t(std::atoi(v));
+    else if (!std::strcmp(k, "--symbols")) cfg.symbols = size_t(std::atol(v));
+    else if (!std::strcmp(k, "--rate")) cfg.tick_rate = std::atof(v);
+    else if (!std::strcmp(k, "--tick-ms")) cfg.tick_interval_ms = std::max(1, std::atoi(v));
+    else if (!std::strcmp(k, "--max-clients")) cfg.max_clients = size_t(std::atol(v));
+    else if (!std::strcmp(k, "--stats")) cfg.stats_interval_s = std::atoi(v);
+    else if (!std::strcmp(k, "--sndbuf-kb")) cfg.sndbuf_bytes = std::atoi(v) * 1024;
+    else if (!std::strcmp(k, "--conflate-kb")) cfg.conflate_bytes = size_t(std::atol(v)) * 1024;
+    else if (!std::strcmp(k, "--max-queue-kb")) cfg.max_queue_bytes = size_t(std::atol(v)) * 1024;
+    else if (!std::strcmp(k, "--stall-ms")) cfg.stall_timeout_ms = std::atoi(v);
+    else if (!std::strcmp(k, "--max-conflation-ms")) cfg.max_conflation_ms = std::atoi(v);
+    else {
+      std::fprintf(stderr, "usage: %s [--port N] [--udp N] [--symbols N] [--rate ticks/s] [--tick-ms N] [--max-clients N] [--stats s]\n"
+                   "          [--sndbuf-kb N] [--conflate-kb N] [--max-queue-kb N] [--stall-ms N] [--max-conflation-ms N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  long fds = fs::raise_fd_limit();
+  if (fds > 0 && size_t(fds) < cfg.max_clients + 16) std::fprintf(stderr, "gateway: fd limit %ld caps clients below %zu\n", fds, cfg.max_clients);
+
+  std::signal(SIGPIPE, SIG_IGN);
+  fs::Gateway gw(cfg);
+  if (!gw.ok()) return 1;
+  g_gateway = &gw;
+  std::signal(SIGINT, on_signal);
+  std::signal(SIGTERM, on_signal);
+  std::fprintf(stderr, "gateway: listening on :%u (%zu symbols, %.0f ticks/s)\n", unsigned(gw.port()), cfg.symbols, cfg.tick_rate);
+  gw.run();
+  g_gateway = nullptr;
+  return 0;
+}
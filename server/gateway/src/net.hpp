@@ -0,0 +1,23 @@
+#pragma once
+// Small socket / clock helpers shared by the gateway and the load tester.
+
+#include <cstdint>
+
+namespace fs {
+
+uint64_t now_us();  // CLOCK_REALTIME, so ingest stamps compare across processes on one box
+uint64_t mono_us();
+
+bool set_nonblocking(int fd);
+void set_nodelay(int fd);
+
+// Non-blocking TCP listener on 0.0.0.0:port (port 0 = ephemeral); -1 on failure
+int listen_tcp(uint16_t port, int backlog);
+// Non-blocking UDP socket bound to 0.0.0.0:port; -1 on failure
+int bind_udp(uint16_t port);
+uint16_t local_port(int fd);
+
+// Raises RLIMIT_NOFILE's soft limit to the hard limit; returns the new soft limit
+long raise_fd_limit();
+
+}  // namespace fs
@@ -0,0 +1,110 @@
+#pragma once
+// Per-connection output queue of shared, pre-encoded frames.
+// A tick is encoded once and every subscriber's queue holds a reference to the same bytes;
+// flushing gathers up to kMaxIov frames into one writev() without copying them.
+//
+// The queue is bounded for ticks: while the backlog stays under the caller's limit ticks are kept in
+// order, and once a client falls behind the queue switches to latest-value-per-symbol conflation:
+// each new tick replaces the one waiting for its symbol, so a slow consumer costs at most one frame
+// per subscribed symbol. The slots are released into the ordered queue only after it drains, and
+// the queue returns to normal once everything has been written. Control frames (handshake, pong,
+// close, errors) are never conflated.
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "subscriptions.hpp"
+
+namespace fs {
+
+using FramePtr = std::shared_ptr<const std::string>;
+
+class OutQueue {
+ public:
+  static constexpr int kMaxIov = 64;
+
+  void push(FramePtr f) {
+    bytes_ += f->size();
+    q_.push_back(std::move(f));
+  }
+
+  // Returns true when the tick replaced an older one for the same symbol (a conflated frame).
+  bool push_tick(SymbolId sym, FramePtr f, size_t limit) {
+    if (!conflating_ && bytes() + f->size() <= limit) {
+      push(std::move(f));
+      return false;
+    }
+    conflating_ = true;
+    slot_bytes_ += f->size();
+    auto it = slot_of_.find(sym);
+    if (it == slot_of_.end()) {
+      slot_of_.emplace(sym, slots_.size());
+      slots_.emplace_back(sym, std::move(f));
+      return false;
+    }
+    FramePtr& held = slots_[it->second].second;
+    slot_bytes_ -= held->size();
+    held = std::move(f);
+    return true;
+  }
+
+  bool empty() const { return q_.empty() && slots_.empty(); }
+  bool conflating() const { return conflating_; }
+  size_t frames() const { return q_.size() + slots_.size(); }
+  size_t bytes() const { return bytes_ - head_off_ + slot_bytes_; }
+
+  // Fills iov with the unsent bytes of up to kMaxIov queued frames; returns the count.
+  // Conflated ticks move into the ordered queue here, once what was ahead of them is gone.
+  int gather(struct iovec* iov) {
+    if (q_.empty()) release_slots();
+    int n = 0;
+    for (auto it = q_.begin(); it != q_.end() && n < kMaxIov; ++it, ++n) {
+      size_t off = n == 0 ? head_off_ : 0;
+      iov[n].iov_base = const_cast<char*>((*it)->data()) + off;
+      iov[n].iov_len = (*it)->size() - off;
+    }
+    return n;
+  }
+
+  // Drops `written` bytes from the front (a partial frame is remembered by offset).
+  void consume(size_t written) {
+    while (written && !q_.empty()) {
+      size_t left = q_.front()->size() - head_off_;
+      if (written < left) {
+        head_off_ += written;
+        return;
+      }
+      written -= left;
+      bytes_ -= q_.front()->size();
+      head_off_ = 0;
+      q_.pop_front();
+    }
+    if (empty()) conflating_ = false;  // caught up
+  }
+
+ private:
+  void release_slots() {
+    for (auto& slot : slots_) push(std::move(slot.second));
+    slots_.clear();
+    slot_of_.clear();
+    slot_bytes_ = 0;
+  }
+
+  std::deque<FramePtr> q_;
+  size_t head_off_ = 0;
+  size_t bytes_ = 0;
+  bool conflating_ = false;
+  std::vector<std::pair<SymbolId, FramePtr>> slots_;  // in first-arrival order
+  std::unordered_map<SymbolId, size_t> slot_of_;
+  size_t slot_bytes_ = 0;
+};
+
+}  // namespace fs
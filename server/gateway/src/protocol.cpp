@@ -0,0 +1,114 @@
+#include "protocol.hpp"
+
+#include <cstdio>
+
+namespace fs {
+
+static const char* kTickers[] = {"AAPL", "MSFT", "GOOG", "AMZN", "TSLA", "NVDA", "BTC", "ETH"};
+
+std::vector<std::string> default_symbols(size_t n) {
+  std::vector<std::string> out;
+  out.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    if (i < sizeof(kTickers) / sizeof(*kTickers)) {
+      out.emplace_back(kTickers[i]);
+    } else {
+      char buf[24];
+      std::snprintf(buf, sizeof buf, "S%04zu", i);
+      out.emplace_back(buf);
+    }
+  }
+  return out;
+}
+
+std::string encode_tick(std::string_view sym, double price, uint64_t ts_ms, uint64_t ingest_us, uint64_t seq) {
+  char buf[160];
+  int n = std::snprintf(buf, sizeof buf, "{\"t\":\"tick\",\"s\":\"%.*s\",\"p\":%.2f,\"ts\":%llu,\"us\":%llu,\"seq\":%llu}",
+                        int(sym.size() > 32 ? 32 : sym.size()), sym.data(), price, (unsigned long long)ts_ms,
+                        (unsigned long long)ingest_us, (unsigned long long)seq);
+  return std::string(buf, n > 0 ? size_t(n) : 0);
+}
+
+static size_t skip_ws(std::string_view s, size_t i) {
+  while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r')) i++;
+  return i;
+}
+
+// position just after `"key"` and its colon, or npos
+static size_t find_key(std::string_view json, std::string_view key) {
+  for (size_t at = json.find(key); at != std::string_view::npos; at = json.find(key, at + 1)) {
+    size_t after = at + key.size();
+    if (at == 0 || json[at - 1] != '"' || after >= json.size() || json[after] != '"') continue;
+    size_t i = skip_ws(json, after + 1);
+    if (i < json.size() && json[i] == ':') return skip_ws(json, i + 1);
+  }
+  return std::string_view::npos;
+}
+
+bool parse_command(std::string_view json, Command& out) {
+  out = Command{};
+  size_t i = find_key(json, "op");
+  if (i == std::string_view::npos || i >= json.size() || json[i] != '"') return false;
+  size_t end = json.find('"', i + 1);
+  if (end == std::string_view::npos) return false;
+  std::string_view op = json.substr(i + 1, end - i - 1);
+  if (op == "sub") out.op = Command::Sub;
+  else if (op == "unsub") out.op = Command::Unsub;
+  else if (op == "metrics") out.op = Command::Metrics;
+  else return false;
+
+  if (out.op == Command::Metrics) {
+    i = find_key(json, "on");
+    out.on = i == std::string_view::npos || json.substr(i, 5) != "false";
+    return true;
+  }
+
+  i = find_key(json, "symbols");
+  if (i == std::string_view::npos || i >= json.size() || json[i] != '[') return false;
+  for (i = skip_ws(json, i + 1); i < json.size() && json[i] != ']'; i = skip_ws(json, i)) {
+    if (json[i] == ',') {
+      i++;
+      continue;
+    }
+    if (json[i] != '"') return false;
+    end = json.find('"', i + 1);
+    if (end == std::string_view::npos) return false;
+    if (end > i + 1) out.symbols.emplace_back(json.substr(i + 1, end - i - 1));
+    i = end + 1;
+  }
+  return i < json.size();
+}
+
+std::string encode_metrics(const MetricsSample& m) {
+  char buf[256];
+  int n = std::snprintf(buf, sizeof buf,
+                        "{\"t\":\"m\",\"ts\":%llu,\"n\":%llu,\"tr\":%llu,\"mr\":%llu,\"lat\":[%llu,%llu,%llu],"
+                        "\"cfl\":%llu,\"cf\":%llu,\"dr\":%llu,\"q\":%llu}",
+                        (unsigned long long)m.ts_ms, (unsigned long long)m.clients, (unsigned long long)m.ticks_per_s,
+                        (unsigned long long)m.frames_per_s, (unsigned long long)m.p50_us, (unsigned long long)m.p99_us,
+                        (unsigned long long)m.p999_us, (unsigned long long)m.conflating, (unsigned long long)m.conflated_per_s,
+                        (unsigned long long)m.dropped, (unsigned long long)m.queued_bytes);
+  return std::string(buf, n > 0 ? size_t(n) : 0);
+}
+
+std::vector<std::string> split_symbols(std::string_view csv) {
+  std::vector<std::string> out;
+  while (!csv.empty()) {
+    size_t comma = csv.find(',');
+    std::string_view item = csv.substr(0, comma);
+    if (!item.empty()) out.emplace_back(item);
+    if (comma == std::string_view::npos) break;
+    csv.remove_prefix(comma + 1);
+  }
+  return out;
+}
+
+uint64_t json_uint(std::string_view json, std::string_view key, uint64_t fallback) {
+  size_t i = find_key(json, key);
+  if (i == std::string_view::npos || i >= json.size() || json[i] < '0' || json[i] > '9') return fallback;
+  uint64_t v = 0;
+  for (; i < json.size() && json[i] >= '0' && json[i] <= '9'; i++) v = v * 10 + uint64_t(json[i] - '0');
+  return v;
+}
+
+}  // namespace fs
@@ -0,0 +1,53 @@
+#pragma once
+// Gateway wire protocol (JSON text frames)
+//   server -> client  {"t":"tick","s":"AAPL","p":182.31,"ts":<epoch ms>,"us":<ingest epoch µs>,"seq":<n>}
+//   server -> client  {"t":"m","ts":<ms>,"n":<clients>,"tr":<ticks/s>,"mr":<frames/s>,"lat":[p50,p99,p999],
+//                      "cfl":<conflating clients>,"cf":<conflated/s>,"dr":<dropped clients>,"q":<queued bytes>}
+//                     once per second to clients that asked for metrics; lat is ingest -> written, in µs
+//   client -> server  {"op":"sub","symbols":["AAPL","MSFT"]}   ("*" = every symbol)
+//                     {"op":"unsub","symbols":["AAPL"]}
+//                     {"op":"metrics","on":true}
+// A client may also subscribe at connect time with GET /?symbols=AAPL,MSFT
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs {
+
+// The dashboard's tickers first, then synthetic S0000, S0001, ... up to n names
+std::vector<std::string> default_symbols(size_t n);
+
+std::string encode_tick(std::string_view sym, double price, uint64_t ts_ms, uint64_t ingest_us, uint64_t seq);
+
+struct Command {
+  enum Op { None, Sub, Unsub, Metrics } op = None;
+  std::vector<std::string> symbols;
+  bool on = true;  // Metrics
+};
+
+struct MetricsSample {
+  uint64_t ts_ms = 0;
+  uint64_t clients = 0;
+  uint64_t ticks_per_s = 0;
+  uint64_t frames_per_s = 0;
+  uint64_t p50_us = 0, p99_us = 0, p999_us = 0;
+  uint64_t conflating = 0;
+  uint64_t conflated_per_s = 0;
+  uint64_t dropped = 0;
+  uint64_t queued_bytes = 0;
+};
+
+std::string encode_metrics(const MetricsSample& m);
+
+// Tolerant scan of a client command; false when it is not one we understand
+bool parse_command(std::string_view json, Command& out);
+
+// "AAPL,MSFT" -> {"AAPL","MSFT"} (empty items dropped)
+std::vector<std::string> split_symbols(std::string_view csv);
+
+// Unsigned integer value of "key": in a flat JSON object, or `fallback`
+uint64_t json_uint(std::string_view json, std::string_view key, uint64_t fallback);
+
+}  // namespace fs
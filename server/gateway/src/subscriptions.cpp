@@ -0,0 +1,74 @@
+#include "subscriptions.hpp"
+
+#include <algorithm>
+
+namespace fs {
+
+namespace {
+
+template <class T>
+bool erase_swap(std::vector<T>& v, T x) {
+  auto it = std::find(v.begin(), v.end(), x);
+  if (it == v.end()) return false;
+  *it = v.back();
+  v.pop_back();
+  return true;
+}
+
+const std::vector<int> kNoClients;
+const std::vector<SymbolId> kNoSymbols;
+
+}  // namespace
+
+SymbolId SymbolTable::intern(std::string_view name) {
+  auto it = ids_.find(std::string(name));
+  if (it != ids_.end()) return it->second;
+  SymbolId id = SymbolId(names_.size());
+  names_.emplace_back(name);
+  ids_.emplace(names_.back(), id);
+  return id;
+}
+
+SymbolId SymbolTable::find(std::string_view name) const {
+  auto it = ids_.find(std::string(name));
+  return it == ids_.end() ? kNoSymbol : it->second;
+}
+
+bool Subscriptions::subscribe(int client, SymbolId sym) {
+  if (client < 0) return false;
+  if (size_t(client) >= by_client_.size()) by_client_.resize(size_t(client) + 1);
+  auto& mine = by_client_[size_t(client)];
+  if (std::find(mine.begin(), mine.end(), sym) != mine.end()) return false;
+  if (sym >= by_symbol_.size()) by_symbol_.resize(size_t(sym) + 1);
+  mine.push_back(sym);
+  by_symbol_[sym].push_back(client);
+  total_++;
+  return true;
+}
+
+bool Subscriptions::unsubscribe(int client, SymbolId sym) {
+  if (client < 0 || size_t(client) >= by_client_.size()) return false;
+  if (!erase_swap(by_client_[size_t(client)], sym)) return false;
+  erase_swap(by_symbol_[sym], client);
+  total_--;
+  return true;
+}
+
+void Subscriptions::remove_client(int client) {
+  if (client < 0 || size_t(client) >= by_client_.size()) return;
+  auto& mine = by_client_[size_t(client)];
+  for (SymbolId sym : mine) erase_swap(by_symbol_[sym], client);
+  total_ -= mine.size();
+  mine.clear();
+  mine.shrink_to_fit();
+}
+
+const std::vector<int>& Subscriptions::subscribers(SymbolId sym) const {
+  return sym < by_symbol_.size() ? by_symbol_[sym] : kNoClients;
+}
+
+const std::vector<SymbolId>& Subscriptions::symbols_of(int client) const {
+  return client >= 0 && size_t(client) < by_client_.size() ? by_client_[size_t(client)] : kNoSymbols;
+}
+
+}  // namespace fs
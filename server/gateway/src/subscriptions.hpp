@@ -0,0 +1,46 @@
+#pragma once
+// Symbol interning and the two-way subscription index used for fan-out:
+// symbol -> subscribed clients (the hot path, a flat vector per symbol) and
+// client -> symbols (so a disconnect only touches the lists it is actually in).
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fs {
+
+using SymbolId = uint32_t;
+constexpr SymbolId kNoSymbol = ~SymbolId(0);
+
+class SymbolTable {
+ public:
+  SymbolId intern(std::string_view name);
+  SymbolId find(std::string_view name) const;  // kNoSymbol when unknown
+  const std::string& name(SymbolId id) const { return names_[id]; }
+  size_t size() const { return names_.size(); }
+
+ private:
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, SymbolId> ids_;
+};
+
+class Subscriptions {
+ public:
+  // Client ids are small integers (the gateway uses the socket fd). Both return false on no-op.
+  bool subscribe(int client, SymbolId sym);
+  bool unsubscribe(int client, SymbolId sym);
+  void remove_client(int client);
+
+  const std::vector<int>& subscribers(SymbolId sym) const;
+  const std::vector<SymbolId>& symbols_of(int client) const;
+  size_t total() const { return total_; }
+
+ private:
+  std::vector<std::vector<int>> by_symbol_;
+  std::vector<std::vector<SymbolId>> by_client_;
+  size_t total_ = 0;
+};
+
+}  // namespace fs
@@ -0,0 +1,174 @@
+#include "ws.hpp"
+
+#include <cstring>
+
+namespace fs {
+
+namespace {
+
+inline uint32_t rol(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+void sha1_block(uint32_t h[5], const uint8_t* p) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++) w[i] = uint32_t(p[4 * i]) << 24 | uint32_t(p[4 * i + 1]) << 16 | uint32_t(p[4 * i + 2]) << 8 | p[4 * i + 3];
+  for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) f = (b & c) | (~b & d), k = 0x5A827999;
+    else if (i < 40) f = b ^ c ^ d, k = 0x6ED9EBA1;
+    else if (i < 60) f = (b & c) | (b & d) | (c & d), k = 0x8F1BBCDC;
+    else f = b ^ c ^ d, k = 0xCA62C1D6;
+    uint32_t t = rol(a, 5) + f + e + k + w[i];
+    e = d, d = c, c = rol(b, 30), b = a, a = t;
+  }
+  h[0] += a, h[1] += b, h[2] += c, h[3] += d, h[4] += e;
+}
+
+bool ieq(std::string_view a, std::string_view b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    char x = a[i], y = b[i];
+    if (x >= 'A' && x <= 'Z') x += 32;
+    if (y >= 'A' && y <= 'Z') y += 32;
+    if (x != y) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void sha1(const uint8_t* data, size_t n, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) sha1_block(h, data + i);
+  uint8_t tail[128] = {};
+  size_t rest = n - i;
+  std::memcpy(tail, data + i, rest);
+  tail[rest] = 0x80;
+  size_t len = rest + 1 + 8 <= 64 ? 64 : 128;
+  uint64_t bits = uint64_t(n) * 8;
+  for (int b = 0; b < 8; b++) tail[len - 1 - b] = uint8_t(bits >> (8 * b));
+  for (size_t off = 0; off < len; off += 64) sha1_block(h, tail + off);
+  for (int k = 0; k < 5; k++)
+    for (int b = 0; b < 4; b++) out[4 * k + b] = uint8_t(h[k] >> (24 - 8 * b));
+}
+
+std::string base64(const uint8_t* data, size_t n) {
+  static const char* abc = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  out.reserve((n + 2) / 3 * 4);
+  for (size_t i = 0; i < n; i += 3) {
+    uint32_t v = uint32_t(data[i]) << 16 | (i + 1 < n ? uint32_t(data[i + 1]) << 8 : 0) | (i + 2 < n ? data[i + 2] : 0);
+    out += abc[v >> 18 & 63];
+    out += abc[v >> 12 & 63];
+    out += i + 1 < n ? abc[v >> 6 & 63] : '=';
+    out += i + 2 < n ? abc[v & 63] : '=';
+  }
+  return out;
+}
+
+std::string websocket_accept(std::string_view key) {
+  std::string s(key);
+  s += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  uint8_t digest[20];
+  sha1(reinterpret_cast<const uint8_t*>(s.data()), s.size(), digest);
+  return base64(digest, 20);
+}
+
+static std::string header(Opcode op, size_t len, bool masked) {
+  std::string h;
+  h += char(0x80 | uint8_t(op));
+  uint8_t m = masked ? 0x80 : 0;
+  if (len < 126) {
+    h += char(m | len);
+  } else if (len <= 0xFFFF) {
+    h += char(m | 126);
+    h += char(len >> 8);
+    h += char(len & 0xFF);
+  } else {
+    h += char(m | 127);
+    for (int b = 7; b >= 0; b--) h += char((uint64_t(len) >> (8 * b)) & 0xFF);
+  }
+  return h;
+}
+
+std::string encode_frame(Opcode op, std::string_view payload) {
+  std::string f = header(op, payload.size(), false);
+  f.append(payload);
+  return f;
+}
+
+std::string encode_masked_frame(Opcode op, std::string_view payload, uint32_t mask) {
+  std::string f = header(op, payload.size(), true);
+  uint8_t key[4] = {uint8_t(mask >> 24), uint8_t(mask >> 16), uint8_t(mask >> 8), uint8_t(mask)};
+  f.append(reinterpret_cast<const char*>(key), 4);
+  size_t at = f.size();
+  f.append(payload);
+  for (size_t i = 0; i < payload.size(); i++) f[at + i] ^= key[i & 3];
+  return f;
+}
+
+long peek_frame(const uint8_t* buf, size_t n, FrameView& out, size_t max_payload) {
+  if (n < 2) return 0;
+  if (buf[0] & 0x70) return -1;  // RSV bits: no extensions negotiated
+  uint8_t op = buf[0] & 0x0F;
+  if (op > 0xA || (op > 0x2 && op < 0x8)) return -1;
+  bool masked = buf[1] & 0x80;
+  uint64_t len = buf[1] & 0x7F;
+  size_t at = 2;
+  if (len == 126) {
+    if (n < 4) return 0;
+    len = uint64_t(buf[2]) << 8 | buf[3];
+    at = 4;
+  } else if (len == 127) {
+    if (n < 10) return 0;
+    len = 0;
+    for (int b = 0; b < 8; b++) len = len << 8 | buf[2 + b];
+    at = 10;
+  }
+  if (len > max_payload) return -1;
+  size_t offset = at + (masked ? 4 : 0);
+  if (n < offset + len) return 0;
+  out.op = Opcode(op);
+  out.fin = buf[0] & 0x80;
+  out.masked = masked;
+  out.offset = offset;
+  out.length = size_t(len);
+  return long(offset + len);
+}
+
+long parse_frame(const uint8_t* buf, size_t n, Frame& out, size_t max_payload) {
+  FrameView v;
+  long used = peek_frame(buf, n, v, max_payload);
+  if (used <= 0) return used;
+  out.op = v.op;
+  out.fin = v.fin;
+  out.payload.assign(reinterpret_cast<const char*>(buf + v.offset), v.length);
+  if (v.masked) {
+    const uint8_t* key = buf + v.offset - 4;
+    for (size_t i = 0; i < v.length; i++) out.payload[i] ^= key[i & 3];
+  }
+  return used;
+}
+
+std::string_view http_header(std::string_view head, std::string_view name) {
+  size_t pos = head.find("\r\n");
+  while (pos != std::string_view::npos && pos + 2 < head.size()) {
+    size_t start = pos + 2;
+    size_t end = head.find("\r\n", start);
+    if (end == std::string_view::npos) end = head.size();
+    std::string_view line = head.substr(start, end - start);
+    size_t colon = line.find(':');
+    if (colon != std::string_view::npos && ieq(line.substr(0, colon), name)) {
+      std::string_view v = line.substr(colon + 1);
+      while (!v.empty() && (v.front() == ' ' || v.front() == '\t')) v.remove_prefix(1);
+      while (!v.empty() && (v.back() == ' ' || v.back() == '\t')) v.remove_suffix(1);
+      return v;
+    }
+    pos = end;
+  }
+  return {};
+}
+
+}  // namespace fs
@@ -0,0 +1,47 @@
+#pragma once
+// RFC 6455 pieces used by the gateway (server side) and the load tester (client side).
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fs {
+
+void sha1(const uint8_t* data, size_t n, uint8_t out[20]);
+std::string base64(const uint8_t* data, size_t n);
+
+// Sec-WebSocket-Accept for a client's Sec-WebSocket-Key
+std::string websocket_accept(std::string_view key);
+
+enum class Opcode : uint8_t { Cont = 0x0, Text = 0x1, Binary = 0x2, Close = 0x8, Ping = 0x9, Pong = 0xA };
+
+// Complete frame, FIN set. Server frames are unmasked; client frames must be masked.
+std::string encode_frame(Opcode op, std::string_view payload);
+std::string encode_masked_frame(Opcode op, std::string_view payload, uint32_t mask);
+
+struct Frame {
+  Opcode op = Opcode::Text;
+  bool fin = true;
+  std::string payload;  // unmasked
+};
+
+// Header-only parse of one frame from buf[0, n): fills the opcode and the payload's offset and length
+// without copying (the payload is still masked if the frame is). Same return values as parse_frame.
+struct FrameView {
+  Opcode op = Opcode::Text;
+  bool fin = true;
+  bool masked = false;
+  size_t offset = 0;  // payload start (after the mask key)
+  size_t length = 0;
+};
+long peek_frame(const uint8_t* buf, size_t n, FrameView& out, size_t max_payload);
+
+// Parses one frame from buf[0, n). Returns bytes consumed, 0 if more input is needed,
+// or -1 on a protocol error (oversized payload, reserved bits, bad opcode).
+long parse_frame(const uint8_t* buf, size_t n, Frame& out, size_t max_payload);
+
+// Value of an HTTP header (case-insensitive name) in a raw request/response head, or "".
+std::string_view http_header(std::string_view head, std::string_view name);
+
+}  // namespace fs
@@ -0,0 +1,271 @@
+// Unit tests for the gateway building blocks plus one loopback round trip through a live Gateway.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "gateway.hpp"
+#include "histogram.hpp"
+#include "out_queue.hpp"
+#include "protocol.hpp"
+#include "subscriptions.hpp"
+#include "ws.hpp"
+
+static int failures = 0;
+
+#define CHECK(cond)                                                    \
+  do {                                                                 \
+    if (!(cond)) {                                                     \
+      std::fprintf(stderr, "%s:%d: CHECK(%s)\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                      \
+    }                                                                  \
+  } while (0)
+
+static void test_handshake_and_frames() {
+  // RFC 6455 section 1.3 example
+  CHECK(fs::websocket_accept("dGhlIHNhbXBsZSBub25jZQ==") == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+
+  std::string small = fs::encode_frame(fs::Opcode::Text, "hi");
+  CHECK(small.size() == 4 && uint8_t(small[0]) == 0x81 && small[1] == 2);
+  std::string big = fs::encode_frame(fs::Opcode::Binary, std::string(70000, 'x'));
+  CHECK(uint8_t(big[1]) == 127 && big.size() == 70000 + 10);
+
+  std::string masked = fs::encode_masked_frame(fs::Opcode::Text, "{\"op\":\"sub\"}", 0x12345678);
+  fs::Frame f;
+  CHECK(fs::parse_frame(reinterpret_cast<const uint8_t*>(masked.data()), masked.size() - 1, f, 1024) == 0);
+  CHECK(fs::parse_frame(reinterpret_cast<const uint8_t*>(masked.data()), masked.size(), f, 1024) == long(masked.size()));
+  CHECK(f.op == fs::Opcode::Text && f.payload == "{\"op\":\"sub\"}");
+  CHECK(fs::parse_frame(reinterpret_cast<const uint8_t*>(big.data()), big.size(), f, 1024) == -1);
+
+  std::string head = "GET / HTTP/1.1\r\nHost: x\r\nsec-websocket-key:  abc== \r\n";
+  CHECK(fs::http_header(head, "Sec-WebSocket-Key") == "abc==");
+  CHECK(fs::http_header(head, "Origin").empty());
+}
+
+static void test_protocol() {
+  fs::Command cmd;
+  CHECK(fs::parse_command("{\"op\":\"sub\", \"symbols\": [\"AAPL\", \"MSFT\"]}", cmd));
+  CHECK(cmd.op == fs::Command::Sub && cmd.symbols.size() == 2 && cmd.symbols[1] == "MSFT");
+  CHECK(fs::parse_command("{\"symbols\":[\"*\"],\"op\":\"unsub\"}", cmd) && cmd.op == fs::Command::Unsub && cmd.symbols[0] == "*");
+  CHECK(!fs::parse_command("{\"op\":\"nope\",\"symbols\":[]}", cmd));
+  CHECK(!fs::parse_command("{\"op\":\"sub\",\"symbols\":[\"AAPL\"", cmd));
+  CHECK(fs::parse_command("{\"op\":\"metrics\",\"on\":false}", cmd) && cmd.op == fs::Command::Metrics && !cmd.on);
+  CHECK(fs::parse_command("{\"op\":\"metrics\"}", cmd) && cmd.on);
+
+  fs::MetricsSample m;
+  m.ts_ms = 5;
+  m.clients = 2;
+  m.p99_us = 900;
+  m.dropped = 1;
+  CHECK(fs::encode_metrics(m) == "{\"t\":\"m\",\"ts\":5,\"n\":2,\"tr\":0,\"mr\":0,\"lat\":[0,900,0],\"cfl\":0,\"cf\":0,\"dr\":1,\"q\":0}");
+
+  std::string tick = fs::encode_tick("AAPL", 182.314, 1700000000123, 1700000000123456, 42);
+  CHECK(tick == "{\"t\":\"tick\",\"s\":\"AAPL\",\"p\":182.31,\"ts\":1700000000123,\"us\":1700000000123456,\"seq\":42}");
+  CHECK(fs::json_uint(tick, "us", 0) == 1700000000123456ull);
+  CHECK(fs::json_uint(tick, "missing", 7) == 7);
+
+  auto syms = fs::default_symbols(10);
+  CHECK(syms[0] == "AAPL" && syms[9] == "S0009");
+  CHECK(fs::split_symbols("A,,B,") == (std::vector<std::string>{"A", "B"}));
+}
+
+static void test_subscriptions() {
+  fs::SymbolTable t;
+  fs::SymbolId a = t.intern("AAPL"), m = t.intern("MSFT");
+  CHECK(t.intern("AAPL") == a && t.find("GOOG") == fs::kNoSymbol);
+
+  fs::Subscriptions s;
+  CHECK(s.subscribe(5, a) && s.subscribe(5, m) && s.subscribe(9, a));
+  CHECK(!s.subscribe(5, a));
+  CHECK(s.subscribers(a).size() == 2 && s.total() == 3);
+  CHECK(s.unsubscribe(9, a) && !s.unsubscribe(9, a));
+  s.remove_client(5);
+  CHECK(s.subscribers(a).empty() && s.subscribers(m).empty() && s.total() == 0);
+  CHECK(s.subscribers(99).empty());
+}
+
+static void test_out_queue() {
+  fs::OutQueue q;
+  auto a = std::make_shared<const std::string>("hello");
+  auto b = std::make_shared<const std::string>("world!");
+  q.push(a);
+  q.push(b);
+  q.push(a);  // the same bytes queued twice, never copied
+  CHECK(q.bytes() == 16 && a.use_count() == 3);
+  iovec iov[fs::OutQueue::kMaxIov];
+  CHECK(q.gather(iov) == 3 && iov[0].iov_base == a->data());
+  q.consume(7);  // "hello" + "wo"
+  CHECK(q.frames() == 2 && q.bytes() == 9);
+  CHECK(q.gather(iov) == 2 && iov[0].iov_len == 4 && std::memcmp(iov[0].iov_base, "rld!", 4) == 0);
+  q.consume(9);
+  CHECK(q.empty() && a.use_count() == 1);
+}
+
+static void test_conflation() {
+  fs::OutQueue q;
+  auto tick = [](const char* s) { return std::make_shared<const std::string>(s); };
+  auto a1 = tick("A1....."), b1 = tick("B1....."), a2 = tick("A2....."), a3 = tick("A3....."), b2 = tick("B2.....");
+  CHECK(!q.push_tick(0, a1, 10) && !q.conflating());  // 7 bytes: under the limit, in order
+  CHECK(!q.push_tick(1, b1, 10) && q.conflating());   // would pass 10 bytes: conflate from here
+  CHECK(!q.push_tick(0, a2, 10));
+  CHECK(q.push_tick(0, a3, 10));  // replaces A2, which is never written
+  CHECK(q.push_tick(1, b2, 10));
+  q.push(std::make_shared<const std::string>("pong"));  // control frames stay in order, never conflated
+  CHECK(q.frames() == 4 && q.bytes() == 7 + 4 + 14);
+
+  iovec iov[fs::OutQueue::kMaxIov];
+  CHECK(q.gather(iov) == 2 && iov[0].iov_base == a1->data());  // slots wait for the backlog
+  q.consume(11);
+  CHECK(q.conflating() && q.gather(iov) == 2);  // now the latest value per symbol, first-arrival order
+  CHECK(iov[0].iov_base == b2->data() && iov[1].iov_base == a3->data());
+  q.consume(14);
+  CHECK(q.empty() && !q.conflating() && a2.use_count() == 1);
+  CHECK(!q.push_tick(0, a1, 10) && !q.conflating());  // caught up: back to in-order delivery
+}
+
+static void test_histogram() {
+  fs::Histogram h;
+  for (uint64_t v = 1; v <= 100000; v++) h.record(v);
+  auto near = [](uint64_t got, uint64_t want) { return got >= want && got <= want + want / 64; };
+  CHECK(near(h.percentile(0.5), 50000));
+  CHECK(near(h.percentile(0.99), 99000));
+  CHECK(h.percentile(1.0) == 100000 && h.max() == 100000);
+  fs::Histogram small;
+  small.record(3);
+  CHECK(small.percentile(0.99) == 3);
+  h.merge(small);
+  CHECK(h.count() == 100001);
+}
+
+// ---------- loopback: subscribe over a real socket and receive a published tick
+
+static std::string read_until(int fd, size_t want) {
+  std::string got;
+  char buf[4096];
+  while (got.size() < want) {
+    ssize_t r = recv(fd, buf, sizeof buf, 0);
+    if (r <= 0) break;
+    got.append(buf, size_t(r));
+  }
+  return got;
+}
+
+static int connect_ws(uint16_t port, const char* symbols, int rcvbuf) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  timeval tv{2, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+  if (rcvbuf) setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof rcvbuf);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof addr) != 0) {
+    close(fd);
+    return -1;
+  }
+  std::string req = std::string("GET /?symbols=") + symbols + " HTTP/1.1\r\nHost: x\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  send(fd, req.data(), req.size(), 0);
+  std::string head;
+  while (head.find("\r\n\r\n") == std::string::npos) {
+    char c;
+    if (recv(fd, &c, 1, 0) != 1) break;
+    head += c;
+  }
+  CHECK(head.compare(0, 12, "HTTP/1.1 101") == 0);
+  CHECK(head.find("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") != std::string::npos);
+  return fd;
+}
+
+static void test_loopback() {
+  fs::GatewayConfig cfg;
+  cfg.port = 0;
+  cfg.tick_rate = 0;
+  cfg.symbols = 8;
+  fs::Gateway gw(cfg);
+  CHECK(gw.ok());
+  if (!gw.ok()) return;
+  std::thread loop([&] { gw.run(); });
+
+  int fd = connect_ws(gw.port(), "MSFT", 0);
+
+  std::string sub = fs::encode_masked_frame(fs::Opcode::Text, "{\"op\":\"sub\",\"symbols\":[\"AAPL\",\"NOT-LISTED\"]}", 0xA1B2C3D4);
+  send(fd, sub.data(), sub.size(), 0);
+  // the query-string subscription plus the sub command
+  for (int i = 0; i < 200 && gw.stats().subscriptions < 2; i++) usleep(5000);
+  CHECK(gw.stats().subscriptions == 2);
+  gw.stop();
+  loop.join();
+  CHECK(gw.symbols().find("NOT-LISTED") == fs::kNoSymbol && gw.symbols().size() == 8);  // clients cannot intern
+
+  // GOOG has no subscriber; AAPL does. Publish with the loop stopped, then drain the queue.
+  gw.publish(gw.symbols().find("GOOG"), 140.0, 1);
+  gw.publish(gw.symbols().find("AAPL"), 190.5, 2);
+  std::thread again([&] { gw.run(); });
+  std::string bytes = read_until(fd, 2);
+  fs::Frame f;
+  long used = fs::parse_frame(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), f, 4096);
+  if (used == 0) {
+    bytes += read_until(fd, 1);
+    used = fs::parse_frame(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), f, 4096);
+  }
+  CHECK(used > 0 && f.payload.find("\"s\":\"AAPL\"") != std::string::npos && f.payload.find("\"us\":2,") != std::string::npos);
+  CHECK(gw.stats().ticks == 2 && gw.stats().frames_queued >= 2);
+  close(fd);
+  gw.stop();
+  again.join();
+}
+
+// a client that stops reading is conflated, never grows past its slots, and is dropped once stalled
+static void test_slow_consumer() {
+  fs::GatewayConfig cfg;
+  cfg.port = 0;
+  cfg.tick_rate = 0;
+  cfg.symbols = 8;
+  cfg.sndbuf_bytes = 4096;
+  cfg.conflate_bytes = 128 * 1024;  // more than the socket buffers hold
+  cfg.stall_timeout_ms = 200;
+  fs::Gateway gw(cfg);
+  if (!gw.ok()) return;
+  std::thread loop([&] { gw.run(); });
+  int fd = connect_ws(gw.port(), "AAPL,MSFT", 4096);
+  for (int i = 0; i < 200 && gw.stats().subscriptions < 2; i++) usleep(5000);
+  gw.stop();
+  loop.join();
+
+  fs::SymbolId aapl = gw.symbols().find("AAPL"), msft = gw.symbols().find("MSFT");
+  for (int i = 0; i < 10000; i++) gw.publish(i % 2 ? aapl : msft, 100 + i * 0.01, uint64_t(i));
+  fs::GatewayStats s = gw.stats();
+  CHECK(s.conflating == 1 && s.conflated > 7000);
+  CHECK(s.max_client_queue <= cfg.conflate_bytes + 2 * 128);  // the ordered backlog plus one slot per symbol
+
+  std::thread again([&] { gw.run(); });  // fills the socket, then nothing drains it
+  for (int i = 0; i < 200 && gw.stats().dropped_stalled == 0; i++) usleep(5000);
+  gw.stop();
+  again.join();
+  s = gw.stats();
+  CHECK(s.dropped_stalled == 1 && s.clients == 0 && s.subscriptions == 0);
+  close(fd);
+}
+
+int main() {
+  std::signal(SIGPIPE, SIG_IGN);
+  test_handshake_and_frames();
+  test_protocol();
+  test_subscriptions();
+  test_out_queue();
+  test_conflation();
+  test_histogram();
+  test_loopback();
+  test_slow_consumer();
+  if (failures) std::fprintf(stderr, "%d check(s) failed\n", failures);
+  else std::printf("all gateway tests passed\n");
+  return failures ? 1 : 0;
+}
@@ -1,8 +1,33 @@
-import { render, screen } from '@testing-library/react';
+import { act, fireEvent, render, screen } from '@testing-library/react';
 import App from './App';
 
-test('renders learn react link', () => {
+beforeEach(() => {
+  jest.useFakeTimers();
+  sessionStorage.clear();
+});
+afterEach(() => jest.useRealTimers());
+
+// the credential check takes 1200 ms; the dashboard opens as soon as it passes
+const login = async (user, pass) => {
+  const [u, p] = screen.getAllByPlaceholderText('admin');
+  fireEvent.change(u, { target: { value: user } });
+  fireEvent.change(p, { target: { value: pass } });
+  fireEvent.submit(u.closest('form'));
+  await act(async () => {
+    jest.advanceTimersByTime(1200);
+  });
+};
+
+test('rejects bad credentials on the login screen', async () => {
+  render(<App />);
+  expect(screen.getByText(/admin \/ admin/i)).toBeInTheDocument();
+  await login('admin', 'nope');
+  expect(screen.getByText('Invalid username or password')).toBeInTheDocument();
+});
+
+test('logs in to the dashboard', async () => {
   render(<App />);
-  const linkElement = screen.getByText(/learn react/i);
-  expect(linkElement).toBeInTheDocument();
+  await login('admin', 'admin');
+  expect(screen.getByText('Top Stocks')).toBeInTheDocument();
+  expect(screen.getByText('Market News')).toBeInTheDocument();
 });
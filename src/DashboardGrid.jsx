@@ -0,0 +1,205 @@
+import React, { memo, useCallback, useLayoutEffect, useRef } from "react";
+import { GripVertical } from "lucide-react";
+import { COLS, MIN_W, compact, moveItem, sameLayout } from "./gridLayout";
+import { spawnGridLayoutWorker } from "./workers";
+import { perfHud } from "./perfHud";
+
+/**
+ * Draggable / resizable dashboard grid
+ * - Layout is committed to React only on drop; during a drag the card (or the resize ghost)
+ *   is moved with a CSS transform from a rAF, so nothing re-renders and no layout is read
+ *   after pointerdown
+ * - Compaction runs in gridLayout.worker.js (main-thread fallback, also taken for good once the
+ *   worker fails to load or errors)
+ * - A layout commit re-renders the grid items with the same child elements, so React bails out
+ *   before reaching the charts; only the items' grid placement changes
+ */
+
+// ---------- worker-backed compaction
+let worker;
+let seq = 0;
+const waiting = new Map(); // seq -> { resolve, layout }
+function compactAsync(layout) {
+  if (worker === undefined) {
+    worker = spawnGridLayoutWorker();
+    if (worker) {
+      worker.onmessage = ({ data }) => {
+        const job = waiting.get(data.seq);
+        waiting.delete(data.seq);
+        perfHud.queueSet("grid", waiting.size);
+        if (job) job.resolve(data.layout);
+      };
+      // a worker that failed to load or threw answers nothing: compact here from now on
+      worker.onerror = worker.onmessageerror = () => {
+        worker.terminate();
+        worker = null;
+        waiting.forEach((job) => job.resolve(compact(job.layout)));
+        waiting.clear();
+        perfHud.queueSet("grid", 0);
+      };
+    }
+  }
+  if (!worker) return Promise.resolve(compact(layout));
+  return new Promise((resolve) => {
+    waiting.set(++seq, { resolve, layout });
+    perfHud.queueSet("grid", waiting.size);
+    worker.postMessage({ seq, layout });
+  });
+}
+
+const GAP = 24; // matches gap-6
+
+const GridItem = memo(function GridItem({ item, register, onHandleDown, onHandleMove, onHandleUp, children }) {
+  const handlers = { onPointerMove: onHandleMove, onPointerUp: onHandleUp, onPointerCancel: onHandleUp };
+  return (
+    <div
+      ref={(el) => register(item.id, el)}
+      className="relative group xl:[grid-column:var(--gc)] xl:[grid-row:var(--gr)]"
+      style={{ "--gc": `${item.x + 1} / span ${item.w}`, "--gr": `${item.y + 1} / span ${item.h}` }}
+    >
+      {children}
+      <button
+        type="button"
+        aria-label="Drag card"
+        className="hidden xl:block absolute top-2 right-2 p-1 rounded-md text-slate-500 opacity-0 group-hover:opacity-100 hover:text-slate-200 cursor-grab touch-none"
+        onPointerDown={(e) => onHandleDown(e, item.id, "move")}
+        {...handlers}
+      >
+        <GripVertical className="w-4 h-4" />
+      </button>
+      <div
+        aria-hidden
+        className="hidden xl:block absolute bottom-1 right-1 w-3 h-3 border-r-2 border-b-2 border-slate-500 opacity-0 group-hover:opacity-100 cursor-ew-resize touch-none"
+        onPointerDown={(e) => onHandleDown(e, item.id, "resize")}
+        {...handlers}
+      />
+    </div>
+  );
+});
+
+export default function DashboardGrid({ layout, onLayoutChange, children, className = "" }) {
+  const gridRef = useRef(null);
+  const ghostRef = useRef(null);
+  const nodes = useRef(new Map());
+  const drag = useRef(null);
+  const settling = useRef(null); // element still showing its drop transform until the new layout commits
+  const layoutRef = useRef(layout);
+  layoutRef.current = layout;
+
+  const register = useCallback((id, el) => {
+    if (el) nodes.current.set(id, el);
+    else nodes.current.delete(id);
+  }, []);
+
+  // the new placement is in the DOM now – drop the interaction transform in the same frame
+  useLayoutEffect(() => {
+    const el = settling.current;
+    settling.current = null;
+    if (el) {
+      el.style.transform = "";
+      el.style.zIndex = "";
+      el.style.willChange = "";
+    }
+  }, [layout]);
+
+  const onHandleDown = useCallback((e, id, mode) => {
+    if (e.button !== 0) return;
+    e.preventDefault();
+    e.currentTarget.setPointerCapture(e.pointerId);
+    const el = nodes.current.get(id);
+    const item = layoutRef.current.find((it) => it.id === id);
+    // all layout reads happen here, once
+    const grid = gridRef.current.getBoundingClientRect();
+    const rect = el.getBoundingClientRect();
+    const rowTops = [];
+    layoutRef.current.forEach((it) => {
+      const node = nodes.current.get(it.id);
+      if (!node) return;
+      const top = node.getBoundingClientRect().top;
+      if (rowTops[it.y] === undefined || top < rowTops[it.y]) rowTops[it.y] = top;
+    });
+    drag.current = { id, mode, el, item, grid, rect, rowTops, colW: (grid.width + GAP) / COLS, x0: e.clientX, y0: e.clientY, dx: 0, dy: 0, raf: 0 };
+    if (mode === "move") {
+      el.style.willChange = "transform";
+      el.style.zIndex = "20";
+    } else {
+      const g = ghostRef.current;
+      g.style.left = `${rect.left - grid.left}px`;
+      g.style.top = `${rect.top - grid.top}px`;
+      g.style.width = `${rect.width}px`;
+      g.style.height = `${rect.height}px`;
+      g.style.transform = "scaleX(1)";
+      g.style.display = "block";
+    }
+  }, []);
+
+  const onHandleMove = useCallback((e) => {
+    const d = drag.current;
+    if (!d) return;
+    d.dx = e.clientX - d.x0;
+    d.dy = e.clientY - d.y0;
+    if (d.raf) return;
+    d.raf = requestAnimationFrame(() => {
+      d.raf = 0;
+      if (d.mode === "move") d.el.style.transform = `translate3d(${d.dx}px, ${d.dy}px, 0)`;
+      else ghostRef.current.style.transform = `scaleX(${Math.max(0.1, (d.rect.width + d.dx) / d.rect.width)})`;
+    });
+  }, []);
+
+  const onHandleUp = useCallback(
+    (e) => {
+      const d = drag.current;
+      if (!d) return;
+      drag.current = null;
+      cancelAnimationFrame(d.raf);
+      ghostRef.current.style.display = "none";
+      let patch;
+      if (d.mode === "move") {
+        const x = Math.round((d.rect.left + d.dx - d.grid.left) / d.colW);
+        const cy = d.rect.top + d.dy + d.rect.height / 2;
+        let y = 0;
+        d.rowTops.forEach((top, row) => {
+          if (top !== undefined && top <= cy) y = row;
+        });
+        if (cy > d.grid.bottom) y = d.rowTops.length;
+        patch = { x, y };
+      } else {
+        const w = Math.max(MIN_W, Math.min(COLS - d.item.x, Math.round((d.rect.width + d.dx + GAP) / d.colW)));
+        patch = { w };
+      }
+      const current = layoutRef.current;
+      const release = () => {
+        d.el.style.transform = "";
+        d.el.style.zIndex = "";
+        d.el.style.willChange = "";
+      };
+      Promise.resolve()
+        .then(() => compactAsync(moveItem(current, d.id, patch)))
+        .then((next) => {
+          if (layoutRef.current !== current || sameLayout(next, current)) release();
+          else {
+            settling.current = d.el;
+            onLayoutChange(next);
+          }
+        })
+        .catch(release); // never leave the card displaced
+    },
+    [onLayoutChange]
+  );
+
+  // DOM order follows the layout so the single-column (< xl) flow matches it
+  const byId = new Map();
+  React.Children.forEach(children, (child) => child && byId.set(child.key, child));
+  return (
+    <div ref={gridRef} className={`relative ${className}`}>
+      {layout.map((item) =>
+        byId.has(item.id) ? (
+          <GridItem key={item.id} item={item} register={register} onHandleDown={onHandleDown} onHandleMove={onHandleMove} onHandleUp={onHandleUp}>
+            {byId.get(item.id)}
+          </GridItem>
+        ) : null
+      )}
+      <div ref={ghostRef} className="absolute hidden pointer-events-none rounded-2xl border-2 border-dashed border-emerald-400/60 origin-left" />
+    </div>
+  );
+}
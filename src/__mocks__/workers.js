@@ -0,0 +1,10 @@
+// Jest stand-in for src/workers.js (mapped in package.json): its `new URL(..., import.meta.url)`
+// does not parse under Jest, and jsdom has no Worker anyway, so every caller takes its fallback.
+export const canSpawnWorkers = () => false;
+export const spawnGridLayoutWorker = () => null;
+export const spawnInstrumentSearchWorker = () => null;
+export const spawnNewsWorker = () => null;
+export const spawnFeedWorker = () => null;
+export const spawnSnapshotWorker = () => null;
+export const spawnCandleImportWorker = () => null;
+export const spawnSharedFeedWorker = () => null;
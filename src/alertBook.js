@@ -0,0 +1,142 @@
+/**
+ * Price alert book (pure; lives in feed.worker.js)
+ * - Per symbol, two sorted level arrays: "up" levels fire when a tick reaches them from below,
+ *   "down" levels when a tick reaches them from above. A move p0 → p1 fires exactly the levels
+ *   in (p0, p1] (or [p1, p0)): two binary searches plus the fired entries, whatever the book size
+ * - kind "above" / "below": one-shot thresholds, removed once fired (or at once if already met)
+ * - kind "cross": level alert in both directions that stays armed
+ * - Adds are buffered and merged into the sorted arrays on that symbol's next tick;
+ *   removals tombstone and the side is compacted once half of it is dead
+ */
+
+const newSide = () => ({ lv: new Float64Array(0), ids: new Int32Array(0), n: 0, dead: 0, pending: [] });
+
+// first index with lv[i] > x
+function upperBound(lv, n, x) {
+  let lo = 0;
+  let hi = n;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (lv[mid] <= x) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+// first index with lv[i] >= x
+function lowerBound(lv, n, x) {
+  let lo = 0;
+  let hi = n;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (lv[mid] < x) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+export function createAlertBook() {
+  const alerts = []; // id -> { id, sym, kind, level, key, live }
+  const books = new Map(); // sym -> { up, down, last }
+  let live = 0;
+
+  const bookOf = (sym) => {
+    let b = books.get(sym);
+    if (!b) books.set(sym, (b = { up: newSide(), down: newSide(), last: NaN }));
+    return b;
+  };
+
+  // merge pending adds and drop tombstones: O(n + k log k), only when something changed
+  function settle(side) {
+    if (!side.pending.length && side.dead * 2 <= side.n) return;
+    const add = side.pending.sort((a, b) => alerts[a].level - alerts[b].level);
+    const n = side.n - side.dead + add.length;
+    const lv = new Float64Array(n);
+    const ids = new Int32Array(n);
+    let i = 0;
+    let j = 0;
+    for (let k = 0; k < n; k++) {
+      while (i < side.n && !alerts[side.ids[i]].live) i++;
+      const takeOld = i < side.n && (j >= add.length || side.lv[i] <= alerts[add[j]].level);
+      const id = takeOld ? side.ids[i++] : add[j++];
+      ids[k] = id;
+      lv[k] = alerts[id].level;
+    }
+    side.lv = lv;
+    side.ids = ids;
+    side.n = n;
+    side.dead = 0;
+    side.pending = [];
+  }
+
+  const fire = (a, price, ts, out) => {
+    out.push({ id: a.id, key: a.key, sym: a.sym, kind: a.kind, level: a.level, price, ts });
+    if (a.kind !== "cross") remove(a.id);
+  };
+
+  /** alert: { sym, kind: "above" | "below" | "cross", level, key? } -> id. Fires into `out` if already met. */
+  function add({ sym, kind, level, key }, out = [], ts = Date.now()) {
+    const a = { id: alerts.length, sym, kind, level: +level, key, live: true };
+    alerts.push(a);
+    live++;
+    const b = bookOf(sym);
+    if ((kind === "above" && b.last >= a.level) || (kind === "below" && b.last <= a.level)) {
+      out.push({ id: a.id, key, sym, kind, level: a.level, price: b.last, ts });
+      a.live = false; // never indexed
+      live--;
+      return a.id;
+    }
+    if (kind !== "below") b.up.pending.push(a.id);
+    if (kind !== "above") b.down.pending.push(a.id);
+    return a.id;
+  }
+
+  function remove(id) {
+    const a = alerts[id];
+    if (!a || !a.live) return false;
+    a.live = false;
+    live--;
+    const b = books.get(a.sym);
+    [b.up, b.down].forEach((side) => {
+      const p = side.pending.indexOf(id);
+      if (p >= 0) side.pending.splice(p, 1);
+      else if (side.n && (a.kind === "cross" || (side === b.up) === (a.kind === "above"))) side.dead++;
+    });
+    return true;
+  }
+
+  /** Applies one price; appends fired alerts to `out` (ascending level on the way up, descending on the way down). */
+  function tick(sym, price, out = [], ts = Date.now()) {
+    const b = books.get(sym);
+    if (!b) {
+      bookOf(sym).last = price;
+      return out;
+    }
+    const prev = b.last;
+    b.last = price;
+    if (!(prev === prev) || price === prev) return out; // first tick (NaN) or no move
+    if (price > prev) {
+      const side = b.up;
+      settle(side);
+      const to = upperBound(side.lv, side.n, price);
+      for (let i = upperBound(side.lv, side.n, prev); i < to; i++) {
+        const a = alerts[side.ids[i]];
+        if (a.live) fire(a, price, ts, out);
+      }
+    } else {
+      const side = b.down;
+      settle(side);
+      const from = lowerBound(side.lv, side.n, price);
+      const to = lowerBound(side.lv, side.n, prev);
+      for (let i = to - 1; i >= from; i--) {
+        const a = alerts[side.ids[i]];
+        if (a.live) fire(a, price, ts, out);
+      }
+    }
+    return out;
+  }
+
+  const stats = () => ({ alerts: live, symbols: books.size });
+
+  return { add, remove, tick, stats, get: (id) => alerts[id] };
+}
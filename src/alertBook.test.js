@@ -0,0 +1,28 @@
+import { createAlertBook } from './alertBook';
+
+const keys = (out) => out.map((f) => f.key);
+
+test('a tick fires only the levels it moves through, in price order', () => {
+  const book = createAlertBook();
+  book.tick('AAPL', 100);
+  [101, 103, 105].forEach((level) => book.add({ sym: 'AAPL', kind: 'above', level, key: `up${level}` }));
+  book.add({ sym: 'AAPL', kind: 'below', level: 98, key: 'down98' });
+  expect(keys(book.tick('AAPL', 103.5))).toEqual(['up101', 'up103']);
+  expect(keys(book.tick('AAPL', 104))).toEqual([]);
+  expect(keys(book.tick('AAPL', 97))).toEqual(['down98']);
+  expect(book.stats().alerts).toBe(1);
+});
+
+test('crossing alerts stay armed; thresholds already met fire on add', () => {
+  const book = createAlertBook();
+  book.tick('BTC', 50);
+  book.add({ sym: 'BTC', kind: 'cross', level: 52, key: 'x' });
+  const out = [];
+  book.add({ sym: 'BTC', kind: 'below', level: 60, key: 'now' }, out);
+  expect(keys(out)).toEqual(['now']);
+  expect(keys(book.tick('BTC', 53))).toEqual(['x']);
+  expect(keys(book.tick('BTC', 51))).toEqual(['x']);
+  const id = book.add({ sym: 'BTC', kind: 'above', level: 55, key: 'gone' });
+  book.remove(id);
+  expect(keys(book.tick('BTC', 56))).toEqual(['x']);
+});
@@ -0,0 +1,66 @@
+import { createRuleSet } from './alertExpr';
+
+// npm run bench -- alertExpr   (not part of `npm test`)
+const RULES = 10000;
+const SYMBOLS = 500;
+const WARMUP_BARS = 210; // longest period used below is 200
+const BARS = 20;
+
+let seed = 5;
+const rnd = () => ((seed = (seed * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+const PERIODS = [10, 20, 50, 100, 200];
+const RSI = [7, 14, 21];
+
+function ruleAt(i) {
+  const p = PERIODS[i % PERIODS.length];
+  const r = RSI[Math.floor(rnd() * RSI.length)];
+  const x = 20 + Math.floor(rnd() * 15);
+  switch (i % 4) {
+    case 0:
+      return `close > sma(${p}) and rsi(${r}) < ${x}`;
+    case 1:
+      return `ema(${p}) > sma(${PERIODS[(i + 1) % PERIODS.length]}) or rsi(${r}) > ${100 - x}`;
+    case 2:
+      return `close >= highest(${p}) and not rsi(${r}) > 70`;
+    default:
+      return `(close - lowest(${p})) / close < 0.0${1 + (i % 5)}`;
+  }
+}
+
+test(`rule evaluation: ${RULES} rules x ${SYMBOLS} symbols`, () => {
+  const rules = createRuleSet();
+  let t0 = performance.now();
+  for (let i = 0; i < RULES; i++) rules.add({ expr: ruleAt(i), key: `r${i}` });
+  const compileMs = performance.now() - t0;
+
+  const syms = Array.from({ length: SYMBOLS }, (_, i) => `S${i}`);
+  const px = syms.map(() => 100 + rnd() * 50);
+  const bar = { open: 0, high: 0, low: 0, close: 0 };
+  const out = [];
+  const step = () => {
+    let fired = 0;
+    syms.forEach((sym, k) => {
+      const open = px[k];
+      px[k] = Math.max(1, open * (1 + (rnd() - 0.5) * 0.02));
+      bar.open = open;
+      bar.close = px[k];
+      bar.high = Math.max(open, px[k]);
+      bar.low = Math.min(open, px[k]);
+      out.length = 0;
+      fired += rules.onBar(sym, bar, out).length;
+    });
+    return fired;
+  };
+  for (let b = 0; b < WARMUP_BARS; b++) step();
+
+  t0 = performance.now();
+  let fired = 0;
+  for (let b = 0; b < BARS; b++) fired += step();
+  const ms = performance.now() - t0;
+  const evalsPerSec = (RULES * SYMBOLS * BARS) / (ms / 1000);
+
+  console.log(
+    JSON.stringify({ bench: 'alertExpr', rules: RULES, symbols: SYMBOLS, ...rules.stats(), compileMs: +compileMs.toFixed(1), msPerBar: +(ms / BARS).toFixed(1), evalsPerSec: Math.round(evalsPerSec), fired }, null, 2)
+  );
+  expect(rules.stats().indicators).toBeLessThan(30); // 10k rules share a couple dozen indicators
+});
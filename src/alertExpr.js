@@ -0,0 +1,367 @@
+/**
+ * Alert rule language (compiled once, evaluated per bar in feed.worker.js)
+ *   rule  := or                      or  := and ("or" and)*       and := not ("and" not)*
+ *   not   := "not" not | cmp         cmp := sum (("<" | "<=" | ">" | ">=" | "==" | "!=") sum)?
+ *   sum   := prod (("+" | "-") prod)*                            prod := unary (("*" | "/") unary)*
+ *   unary := "-" unary | number | field | fn "(" number ")" | "(" rule ")"
+ *   field := open | high | low | close | price                   fn  := sma | ema | rsi | highest | lowest
+ * e.g. `close > sma(50) and rsi(14) < 30`
+ * - Every distinct subexpression is hash-consed across the rule set: all rules that mention sma(50)
+ *   share one streaming SMA per symbol, and a subexpression used by several rules runs once per bar
+ * - Indicators read NaN until their period has filled, so comparisons on them are false
+ * - A rule fires on the bar where it turns true, per symbol
+ */
+
+const FIELDS = { open: 0, high: 1, low: 2, close: 3, price: 3 };
+const BASE_SLOTS = 4;
+
+// ---------- streaming indicators: make(n) -> (bar) => value
+const INDICATORS = {
+  sma(n) {
+    const buf = new Float64Array(n);
+    let i = 0;
+    let count = 0;
+    let sum = 0;
+    return (bar) => {
+      sum += bar.close - buf[i];
+      buf[i] = bar.close;
+      i = (i + 1) % n;
+      if (count < n) count++;
+      return count < n ? NaN : sum / n;
+    };
+  },
+  ema(n) {
+    const k = 2 / (n + 1);
+    let count = 0;
+    let value = 0;
+    return (bar) => {
+      // seeded with the SMA of the first n closes
+      if (count < n) {
+        value += bar.close / n;
+        return ++count < n ? NaN : value;
+      }
+      value += k * (bar.close - value);
+      return value;
+    };
+  },
+  rsi(n) {
+    // Wilder smoothing
+    let prev = NaN;
+    let count = 0;
+    let gain = 0;
+    let loss = 0;
+    return (bar) => {
+      const d = bar.close - prev;
+      prev = bar.close;
+      if (!(d === d)) return NaN;
+      const up = d > 0 ? d : 0;
+      const down = d < 0 ? -d : 0;
+      if (count < n) {
+        gain += up / n;
+        loss += down / n;
+        if (++count < n) return NaN;
+      } else {
+        gain = (gain * (n - 1) + up) / n;
+        loss = (loss * (n - 1) + down) / n;
+      }
+      return loss === 0 ? 100 : 100 - 100 / (1 + gain / loss);
+    };
+  },
+  highest: (n) => extreme(n, (bar) => bar.high, (a, b) => a >= b),
+  lowest: (n) => extreme(n, (bar) => bar.low, (a, b) => a <= b),
+};
+
+// rolling max/min over n bars with a monotonic deque (amortized O(1) per bar)
+function extreme(n, pick, dominates) {
+  const vals = new Float64Array(n + 1);
+  const at = new Float64Array(n + 1);
+  let head = 0;
+  let size = 0;
+  let t = 0;
+  const cap = n + 1;
+  return (bar) => {
+    const x = pick(bar);
+    while (size && dominates(x, vals[(head + size - 1) % cap])) size--;
+    vals[(head + size) % cap] = x;
+    at[(head + size) % cap] = t;
+    size++;
+    if (at[head] <= t - n) {
+      head = (head + 1) % cap;
+      size--;
+    }
+    return ++t < n ? NaN : vals[head];
+  };
+}
+
+// ---------- parser
+const TOKEN = /\s*(?:(\d+(?:\.\d+)?|\.\d+)|([A-Za-z_][A-Za-z0-9_]*)|(<=|>=|==|!=|[-+*/()<>]))/y;
+
+function tokenize(src) {
+  const out = [];
+  TOKEN.lastIndex = 0;
+  let pos = 0;
+  while (pos < src.length) {
+    if (!src.slice(pos).trim()) break;
+    const m = TOKEN.exec(src);
+    if (!m) throw new Error(`alert rule: unexpected "${src.slice(pos).trim()[0]}" at ${pos}`);
+    const at = m.index + m[0].length - (m[1] || m[2] || m[3]).length;
+    if (m[1]) out.push({ t: "num", v: Number(m[1]), at });
+    else if (m[2]) out.push({ t: "id", v: m[2].toLowerCase(), at });
+    else out.push({ t: "op", v: m[3], at });
+    pos = TOKEN.lastIndex;
+  }
+  out.push({ t: "end", v: "", at: src.length });
+  return out;
+}
+
+export function parseRule(src) {
+  const toks = tokenize(String(src));
+  let i = 0;
+  const peek = () => toks[i];
+  const fail = (tok, what) => {
+    throw new Error(`alert rule: expected ${what} at ${tok.at}${tok.t === "end" ? " (end of rule)" : ` near "${tok.v}"`}`);
+  };
+  const accept = (v) => (toks[i].v === v && toks[i].t !== "num" ? toks[i++] : null);
+  const expect = (v) => accept(v) || fail(peek(), `"${v}"`);
+
+  const binary = (next, ops, kind) => () => {
+    let a = next();
+    for (let op = ops.find(accept); op; op = ops.find(accept)) a = { op: kind, o: op, a, b: next() };
+    return a;
+  };
+  const unary = () => {
+    const tok = peek();
+    if (accept("-")) return { op: "neg", a: unary() };
+    if (accept("(")) {
+      const e = or();
+      expect(")");
+      return e;
+    }
+    if (tok.t === "num") {
+      i++;
+      return { op: "num", v: tok.v };
+    }
+    if (tok.t === "id" && tok.v in FIELDS) {
+      i++;
+      return { op: "field", name: tok.v === "price" ? "close" : tok.v };
+    }
+    if (tok.t === "id" && INDICATORS[tok.v]) {
+      i++;
+      expect("(");
+      const n = peek();
+      if (n.t !== "num" || !Number.isInteger(n.v) || n.v < 1 || n.v > 1000) fail(n, "a period between 1 and 1000");
+      i++;
+      expect(")");
+      return { op: "ind", fn: tok.v, n: n.v };
+    }
+    return fail(tok, "a number, field or indicator");
+  };
+  const prod = binary(unary, ["*", "/"], "arith");
+  const sum = binary(prod, ["+", "-"], "arith");
+  const cmp = () => {
+    const a = sum();
+    const o = ["<=", ">=", "==", "!=", "<", ">"].find(accept);
+    return o ? { op: "cmp", o, a, b: sum() } : a;
+  };
+  const not = () => (accept("not") ? { op: "not", a: not() } : cmp());
+  const and = binary(not, ["and"], "logic");
+  const or = binary(and, ["or"], "logic");
+
+  const ast = or();
+  if (peek().t !== "end") fail(peek(), "an operator or end of rule");
+  return ast;
+}
+
+// canonical text of a subexpression (the hash-consing key)
+const keyOf = (n) => {
+  switch (n.op) {
+    case "num":
+      return `${n.v}`;
+    case "field":
+      return n.name;
+    case "ind":
+      return `${n.fn}(${n.n})`;
+    case "neg":
+    case "not":
+      return `(${n.op} ${keyOf(n.a)})`;
+    default:
+      return `(${keyOf(n.a)} ${n.o} ${keyOf(n.b)})`;
+  }
+};
+
+// ---------- rule set
+export function createRuleSet() {
+  const nodes = new Map(); // canonical key -> node { key, refs, fn, children, indicator }
+  const indicators = []; // { slot, make, refs }
+  const indicatorByKey = new Map();
+  const rules = []; // id -> { id, key, sym, expr, root, live }; a removed rule's id is reused
+  const active = []; // live rules, in the order they were added
+  const free = []; // ids of removed rules
+  const symbols = new Map(); // sym -> { vals, states, on }
+  const scratch = { memo: new Float64Array(64), gen: new Uint32Array(64) };
+  let memoSlots = 0;
+  let gen = 1;
+
+  // memoized only while shared; a private subexpression is cheaper to just evaluate
+  const shared = (node, raw) => {
+    const m = memoSlots++;
+    if (m >= scratch.memo.length) {
+      const memo = new Float64Array(scratch.memo.length * 2);
+      const g = new Uint32Array(scratch.gen.length * 2);
+      memo.set(scratch.memo);
+      g.set(scratch.gen);
+      scratch.memo = memo;
+      scratch.gen = g;
+    }
+    return (v) => {
+      if (node.refs < 2) return raw(v);
+      if (scratch.gen[m] === gen) return scratch.memo[m];
+      scratch.gen[m] = gen;
+      return (scratch.memo[m] = raw(v));
+    };
+  };
+
+  function indicatorSlot(fn, n) {
+    const k = `${fn}(${n})`;
+    let ind = indicatorByKey.get(k);
+    if (!ind) {
+      ind = { slot: BASE_SLOTS + indicators.length, make: () => INDICATORS[fn](n), refs: 0 };
+      indicators.push(ind);
+      indicatorByKey.set(k, ind);
+    }
+    ind.refs++;
+    return ind.slot;
+  }
+
+  function build(ast) {
+    const key = keyOf(ast);
+    const existing = nodes.get(key);
+    if (existing) {
+      existing.refs++;
+      return existing;
+    }
+    const children = [ast.a, ast.b].filter(Boolean).map(build);
+    const node = { key, refs: 1, children, indicator: null };
+    const [fa, fb] = children.map((c) => c.fn);
+    let raw;
+    switch (ast.op) {
+      case "num": {
+        const c = ast.v;
+        raw = () => c;
+        break;
+      }
+      case "field":
+      case "ind": {
+        const s = ast.op === "field" ? FIELDS[ast.name] : indicatorSlot(ast.fn, ast.n);
+        node.indicator = ast.op === "ind" ? indicatorByKey.get(key) : null;
+        raw = (v) => v[s];
+        break;
+      }
+      case "neg":
+        raw = (v) => -fa(v);
+        break;
+      case "not":
+        raw = (v) => (fa(v) ? 0 : 1);
+        break;
+      case "arith":
+        raw = { "+": (v) => fa(v) + fb(v), "-": (v) => fa(v) - fb(v), "*": (v) => fa(v) * fb(v), "/": (v) => fa(v) / fb(v) }[ast.o];
+        break;
+      case "cmp":
+        raw = {
+          "<": (v) => (fa(v) < fb(v) ? 1 : 0),
+          "<=": (v) => (fa(v) <= fb(v) ? 1 : 0),
+          ">": (v) => (fa(v) > fb(v) ? 1 : 0),
+          ">=": (v) => (fa(v) >= fb(v) ? 1 : 0),
+          "==": (v) => (fa(v) === fb(v) ? 1 : 0),
+          "!=": (v) => (fa(v) !== fb(v) ? 1 : 0),
+        }[ast.o];
+        break;
+      default:
+        raw = ast.o === "and" ? (v) => (fa(v) && fb(v) ? 1 : 0) : (v) => (fa(v) || fb(v) ? 1 : 0);
+    }
+    node.fn = children.length ? shared(node, raw) : raw;
+    nodes.set(key, node);
+    return node;
+  }
+
+  function release(node) {
+    if (--node.refs > 0) return;
+    nodes.delete(node.key);
+    const ind = node.indicator;
+    // an unused indicator stops stepping; a later rule restarts it from an empty window
+    if (ind && --ind.refs === 0) {
+      symbols.forEach((st) => {
+        st.states[ind.slot - BASE_SLOTS] = undefined;
+        if (ind.slot < st.vals.length) st.vals[ind.slot] = NaN;
+      });
+    }
+    node.children.forEach(release);
+  }
+
+  function stateOf(sym) {
+    let s = symbols.get(sym);
+    if (!s) symbols.set(sym, (s = { vals: new Float64Array(BASE_SLOTS), states: [], on: new Uint8Array(64) }));
+    if (s.vals.length < BASE_SLOTS + indicators.length) {
+      const vals = new Float64Array(BASE_SLOTS + indicators.length * 2).fill(NaN);
+      vals.set(s.vals);
+      s.vals = vals;
+    }
+    if (s.on.length < rules.length) {
+      const on = new Uint8Array(rules.length * 2);
+      on.set(s.on);
+      s.on = on;
+    }
+    return s;
+  }
+
+  /** rule: { expr, sym?, key? } – sym omitted = every symbol. Throws on a syntax error. */
+  function add({ expr, sym, key }) {
+    const root = build(parseRule(expr));
+    const id = free.length ? free.pop() : rules.length;
+    rules[id] = { id, key, sym, expr, root, live: true };
+    active.push(rules[id]);
+    symbols.forEach((st) => id < st.on.length && (st.on[id] = 0));
+    return id;
+  }
+
+  function remove(id) {
+    const r = rules[id];
+    if (!r || !r.live) return false;
+    r.live = false;
+    active.splice(active.indexOf(r), 1);
+    free.push(id);
+    release(r.root);
+    return true;
+  }
+
+  /** Feeds one completed bar { open, high, low, close } for `sym`; appends rules that turned true to `out`. */
+  function onBar(sym, bar, out = [], ts = Date.now()) {
+    const s = stateOf(sym);
+    const v = s.vals;
+    v[0] = bar.open;
+    v[1] = bar.high;
+    v[2] = bar.low;
+    v[3] = bar.close;
+    for (let k = 0; k < indicators.length; k++) {
+      const ind = indicators[k];
+      if (!ind.refs) continue;
+      const step = s.states[k] || (s.states[k] = ind.make());
+      v[ind.slot] = step(bar);
+    }
+    gen = (gen + 1) >>> 0 || 1;
+    const on = s.on;
+    for (let i = 0; i < active.length; i++) {
+      const r = active[i];
+      if (r.sym && r.sym !== sym) continue;
+      const id = r.id;
+      const now = r.root.fn(v);
+      if (now && !on[id]) out.push({ id, key: r.key, sym, kind: "expr", expr: r.expr, price: bar.close, ts });
+      on[id] = now;
+    }
+    return out;
+  }
+
+  const stats = () => ({ rules: active.length, nodes: nodes.size, indicators: indicators.filter((i) => i.refs).length });
+
+  return { add, remove, onBar, stats };
+}
@@ -0,0 +1,54 @@
+import { createRuleSet, parseRule } from './alertExpr';
+
+const bar = (close) => ({ open: close, high: close, low: close, close });
+
+test('syntax errors point at the offending token', () => {
+  expect(() => parseRule('close > sma(50')).toThrow('expected ")" at 14');
+  expect(() => parseRule('volume > 1')).toThrow('near "volume"');
+  expect(() => parseRule('close > sma(0)')).toThrow('period');
+});
+
+test('rules fire on the bar they turn true, per symbol', () => {
+  const rules = createRuleSet();
+  rules.add({ expr: 'close > sma(3) and not close > 20', key: 'breakout' });
+  const fired = (sym, close) => rules.onBar(sym, bar(close)).map((f) => f.key);
+  [10, 10, 10].forEach((c) => expect(fired('A', c)).toEqual([])); // sma(3) warming up, then equal
+  expect(fired('A', 12)).toEqual(['breakout']);
+  expect(fired('A', 13)).toEqual([]); // still true: no re-fire
+  expect(fired('A', 25)).toEqual([]);
+  expect(fired('B', 12)).toEqual([]); // B has its own indicator state
+});
+
+test('shared subexpressions and indicators are compiled once', () => {
+  const rules = createRuleSet();
+  const a = rules.add({ expr: 'close > sma(50) and rsi(14) < 30' });
+  rules.add({ expr: 'CLOSE > SMA(50) and rsi(14) < 40' });
+  expect(rules.stats()).toEqual({ rules: 2, nodes: 10, indicators: 2 });
+  rules.remove(a);
+  expect(rules.stats()).toEqual({ rules: 1, nodes: 7, indicators: 2 });
+});
+
+test('an indicator dropped by its last rule restarts from an empty window', () => {
+  const rules = createRuleSet();
+  const a = rules.add({ expr: 'sma(3) < 500', key: 'a' });
+  [10, 10, 10].forEach((c) => rules.onBar('A', bar(c)));
+  rules.remove(a);
+  for (let i = 0; i < 100; i++) rules.onBar('A', bar(1000));
+  rules.add({ expr: 'sma(3) < 500', key: 'b' });
+  expect(rules.onBar('A', bar(1000))).toEqual([]);
+});
+
+test('removed rules are not scanned and their ids are reused', () => {
+  const rules = createRuleSet();
+  const ids = [];
+  for (let i = 0; i < 100; i++) {
+    const id = rules.add({ expr: 'close > 5', key: `k${i}` });
+    ids.push(id);
+    rules.onBar('A', bar(10));
+    rules.remove(id);
+  }
+  expect(new Set(ids).size).toBe(1);
+  const id = rules.add({ expr: 'close > 5', key: 'last' });
+  expect(rules.onBar('A', bar(10)).map((f) => [f.id, f.key])).toEqual([[id, 'last']]); // fires afresh on a reused id
+  expect(rules.stats()).toEqual({ rules: 1, nodes: 3, indicators: 0 });
+});
@@ -0,0 +1,121 @@
+import { fromRows } from "./seriesStore";
+import { telemetry } from "./telemetry";
+import { readInstruments } from "./refdata";
+
+/**
+ * Mock REST endpoints: stand-ins until a real backend serves them.
+ * Each resolves after a simulated round trip with the payload shape a server would send;
+ * callers go through fetchCache rather than calling these directly.
+ */
+
+const DAY = 86400000;
+const roundTrip = (value, ms = 80 + Math.random() * 120) => {
+  const t0 = performance.now();
+  return new Promise((resolve) =>
+    setTimeout(() => {
+      telemetry.record("api", (performance.now() - t0) * 1000);
+      resolve(value);
+    }, ms)
+  );
+};
+
+// columnar daily series starting Apr 1 2024 (same calendar as the candles)
+const genSeries = (len = 30) =>
+  fromRows(
+    Array.from({ length: len }, (_, i) => i),
+    (i) => Date.UTC(2024, 3, 1) + i * DAY,
+    ["v"],
+    (i) => [100 + Math.sin(i / 3) * 8 + Math.random() * 2]
+  );
+
+// candlestick sample
+const candles = () =>
+  fromRows(
+    [
+      { x: new Date("2024-04-05").getTime(), y: [135, 140, 132, 138] },
+      { x: new Date("2024-04-06").getTime(), y: [138, 145, 137, 142] },
+      { x: new Date("2024-04-07").getTime(), y: [142, 150, 140, 148] },
+      { x: new Date("2024-04-08").getTime(), y: [148, 155, 146, 152] },
+      { x: new Date("2024-04-09").getTime(), y: [150, 158, 147, 155] },
+    ],
+    (r) => r.x,
+    ["o", "h", "l", "c"],
+    (r) => r.y
+  );
+
+const HISTORY = { stocks: () => genSeries(21), crypto: () => genSeries(21), candles };
+
+// key: "history:<id>"
+export const fetchHistory = (key) => {
+  const make = HISTORY[key.slice(key.indexOf(":") + 1)];
+  return make ? roundTrip(make()) : Promise.reject(new Error(`unknown history ${key}`));
+};
+
+// ---------- instrument reference data: one fetch of the binary file (refdata.js), read in place
+let refdata;
+export function loadRefdata() {
+  if (!refdata) {
+    refdata = Promise.resolve()
+      .then(() => fetch(`${process.env.PUBLIC_URL || ""}/data/instruments.bin`))
+      .then((res) => (res.ok ? res.arrayBuffer() : null))
+      .then((buf) => buf && readInstruments(buf))
+      .catch(() => null);
+  }
+  return refdata;
+}
+
+// f32 tick sizes back to their decimal spelling (0.01, not 0.009999999776)
+const fromRef = (ref, id, iid) => ({
+  id,
+  iid,
+  name: ref.name(iid),
+  sector: ref.sector(iid),
+  currency: ref.currency(iid),
+  tickSize: +ref.tickSize[iid].toPrecision(6),
+  lotSize: ref.lotSize[iid],
+});
+
+// ---------- entities (GraphQL-style: one request for many ids, related records included)
+// static instruments stand in when instruments.bin is unavailable
+const INSTRUMENTS = [
+  { id: "AAPL", name: "Apple Inc.", sector: "Technology" },
+  { id: "MSFT", name: "Microsoft Corp.", sector: "Technology" },
+  { id: "GOOG", name: "Alphabet Inc.", sector: "Communication" },
+  { id: "AMZN", name: "Amazon.com Inc.", sector: "Consumer" },
+  { id: "TSLA", name: "Tesla Inc.", sector: "Consumer" },
+  { id: "NVDA", name: "NVIDIA Corp.", sector: "Technology" },
+  { id: "BTC", name: "Bitcoin", sector: "Crypto" },
+  { id: "ETH", name: "Ethereum", sector: "Crypto" },
+  { id: "FIN", name: "Finance", sector: "Financials" },
+  { id: "HLTH", name: "Healthcare", sector: "Health Care" },
+  { id: "ENG", name: "Energy", sector: "Energy" },
+];
+const POSITIONS = [
+  { id: "p1", account: "main", sym: "AAPL", pct: 45 },
+  { id: "p2", account: "main", sym: "FIN", pct: 25 },
+  { id: "p3", account: "main", sym: "HLTH", pct: 18 },
+  { id: "p4", account: "main", sym: "ENG", pct: 12 },
+];
+const ACCOUNTS = [{ id: "main", name: "Main portfolio", currency: "USD", positions: POSITIONS.map((p) => p.id) }];
+const TABLES = { instrument: INSTRUMENTS, position: POSITIONS, account: ACCOUNTS };
+
+// batch: { [type]: ids } -> { [type]: entities }; instruments carry their refdata id as `iid`
+export async function fetchEntities(batch) {
+  const ref = await loadRefdata();
+  const out = { instrument: new Map(), position: new Map(), account: new Map() };
+  const find = (type, id) => {
+    const iid = ref && type === "instrument" ? ref.idOf(id) : -1;
+    return iid >= 0 ? fromRef(ref, id, iid) : TABLES[type].find((x) => x.id === id);
+  };
+  const put = (type, id) => {
+    const e = find(type, id);
+    if (!e || out[type].has(id)) return;
+    out[type].set(id, e);
+    if (type === "account") e.positions.forEach((p) => put("position", p));
+    if (type === "position") put("instrument", e.sym);
+  };
+  Object.keys(batch).forEach((type) => TABLES[type] && batch[type].forEach((id) => put(type, id)));
+  const payload = {};
+  Object.keys(out).forEach((type) => (payload[type] = Array.from(out[type].values())));
+  return roundTrip(payload, 40 + Math.random() * 60);
+}
@@ -0,0 +1,43 @@
+import { createCandleParser } from './candleCsv';
+
+// npm run bench -- candleCsv   (not part of `npm test`)
+// Parse throughput over an in-memory CSV fed in 4 MB slices, as candleImport.worker.js reads a
+// file; ISO-time and epoch-time files are measured separately. Target: >= 200 MB/s on a laptop.
+const ROWS = 2000000;
+const SLICE = 4 << 20;
+
+let seed = 11;
+const rnd = () => ((seed = (seed * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+
+function makeCsv(iso) {
+  const lines = ['timestamp,open,high,low,close,volume'];
+  let t = Date.UTC(2015, 0, 1);
+  let px = 100;
+  for (let i = 0; i < ROWS; i++, t += 60000) {
+    const o = px;
+    px = Math.max(1, px * (1 + (rnd() - 0.5) * 0.01));
+    const time = iso ? new Date(t).toISOString().slice(0, 19) + 'Z' : t / 1000;
+    lines.push(`${time},${o.toFixed(2)},${(Math.max(o, px) * 1.001).toFixed(2)},${(Math.min(o, px) * 0.999).toFixed(2)},${px.toFixed(2)},${Math.floor(rnd() * 1e6)}`);
+  }
+  return new TextEncoder().encode(lines.join('\n') + '\n');
+}
+
+test.each([['epoch seconds', false], ['ISO 8601', true]])(`parse ${ROWS} rows, %s`, (label, iso) => {
+  const buf = makeCsv(iso);
+  const runs = [];
+  let series;
+  for (let r = 0; r < 3; r++) {
+    const p = createCandleParser();
+    const t0 = performance.now();
+    for (let off = 0; off < buf.length; off += SLICE) {
+      p.push(buf.subarray(off, off + SLICE));
+      if (off === 0) p.reserve(Math.ceil(((p.stats().rows * buf.length) / SLICE) * 1.02));
+    }
+    series = p.end();
+    runs.push(performance.now() - t0);
+  }
+  const ms = Math.min(...runs);
+  const mb = buf.length / (1 << 20);
+  console.log(JSON.stringify({ bench: 'candleCsv', times: label, rows: series.length, mb: +mb.toFixed(1), ms: +ms.toFixed(1), mbPerSec: Math.round(mb / (ms / 1000)) }, null, 2));
+  expect(series.length).toBe(ROWS);
+});
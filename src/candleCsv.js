@@ -0,0 +1,304 @@
+import { createSeries, reserve } from "./seriesStore";
+
+/**
+ * Streaming OHLCV CSV parser (pure; lives in candleImport.worker.js)
+ * - push(Uint8Array) as chunks arrive, end() once; bytes are scanned in place and numbers are
+ *   built digit by digit, so no string is made per line or per file
+ * - Rows land straight in a seriesStore series (o/h/l/c, plus v when the file has volume)
+ * - First line: a header naming the columns (date/time/timestamp, open, high, low, close, volume,
+ *   any order, extra columns ignored), or data in t,o,h,l,c[,v] order. Delimiter is , ; or tab
+ * - Times: epoch seconds or ms, or ISO 8601 (date, optional time, Z or ±hh:mm; UTC when none)
+ * - Rows with an unreadable time or o/h/l/c are counted in `skipped`, not fatal
+ * - Newest-first files are reversed and unordered ones sorted at end(): the series is ascending
+ */
+
+const NL = 10;
+const CR = 13;
+const QUOTE = 34;
+const T = 0; // slot of the time in a row; o/h/l/c/v follow
+const ALIASES = [
+  ["t", "time", "date", "datetime", "timestamp", "ts", "open time", "opentime"],
+  ["o", "open"],
+  ["h", "high"],
+  ["l", "low"],
+  ["c", "close", "last", "price"],
+  ["v", "volume", "vol"],
+];
+const FIELDS = ["o", "h", "l", "c", "v"];
+const MAX_EXACT_DIGITS = 15; // beyond this the digit loop can round differently from parseFloat
+
+const text = new TextDecoder();
+const clean = (s) => s.trim().replace(/^"|"$/g, "").trim();
+
+// days since 1970-01-01 for a proleptic Gregorian date (Hinnant's days_from_civil)
+function daysFromCivil(y, m, d) {
+  y -= m <= 2 ? 1 : 0;
+  const era = Math.floor(y / 400);
+  const yoe = y - era * 400;
+  const doy = Math.floor((153 * (m + (m > 2 ? -3 : 9)) + 2) / 5) + d - 1;
+  const doe = yoe * 365 + Math.floor(yoe / 4) - Math.floor(yoe / 100) + doy;
+  return era * 146097 + doe - 719468;
+}
+
+// n ASCII digits at b[i]; NaN if any is not one
+function digitsAt(b, i, n) {
+  let v = 0;
+  for (let k = i; k < i + n; k++) {
+    const d = b[k] - 48;
+    if (!(d >= 0 && d <= 9)) return NaN;
+    v = v * 10 + d;
+  }
+  return v;
+}
+
+const isPad = (c) => c === QUOTE || c === 32 || c === CR;
+
+// ISO 8601 in b[i, end) to epoch ms in scratch[0]; false when it is not one. Called per row, so
+// the result goes through a typed array: a returned double would be boxed on every call
+const scratch = new Float64Array(1);
+const done = (ms) => {
+  scratch[0] = ms;
+  return ms === ms; // a non-digit in hh/mm/ss made it NaN
+};
+function isoTime(b, i, end) {
+  while (i < end && isPad(b[i])) i++;
+  while (end > i && isPad(b[end - 1])) end--;
+  if (end - i < 10 || b[i + 4] !== 45 || b[i + 7] !== 45) return false;
+  const mo = digitsAt(b, i + 5, 2);
+  const d = digitsAt(b, i + 8, 2);
+  if (!(mo >= 1 && mo <= 12 && d >= 1 && d <= 31)) return false;
+  let ms = daysFromCivil(digitsAt(b, i, 4), mo, d) * 86400000;
+  i += 10;
+  if (i === end) return done(ms);
+  // 'T' or ' ', then hh:mm
+  if ((b[i] !== 84 && b[i] !== 32) || end - i < 6 || b[i + 3] !== 58) return false;
+  ms += digitsAt(b, i + 1, 2) * 3600000 + digitsAt(b, i + 4, 2) * 60000;
+  i += 6;
+  if (i < end && b[i] === 58) {
+    ms += digitsAt(b, i + 1, 2) * 1000;
+    i += 3;
+    if (i < end && (b[i] === 46 || b[i] === 44)) {
+      let scale = 100;
+      for (i++; i < end && b[i] >= 48 && b[i] <= 57; i++, scale /= 10) ms += (b[i] - 48) * scale;
+    }
+  }
+  if (i === end) return done(ms);
+  if (b[i] === 90) return i + 1 === end && done(ms); // 'Z'
+  const sign = b[i] === 43 ? -1 : b[i] === 45 ? 1 : 0; // +hh:mm is ahead of UTC
+  if (!sign || end - i < 3) return false;
+  const om = end - i === 6 && b[i + 3] === 58 ? digitsAt(b, i + 4, 2) : end - i === 5 ? digitsAt(b, i + 3, 2) : end - i === 3 ? 0 : NaN;
+  return done(ms + sign * (digitsAt(b, i + 1, 2) * 3600000 + om * 60000));
+}
+
+export const parseIsoTime = (b, i = 0, end = b.length) => (isoTime(b, i, end) ? scratch[0] : NaN);
+
+// epoch seconds below this, ms above (1e11 s is the year 5138; 1e11 ms is 1973)
+const toMs = (v) => (Math.abs(v) < 1e11 ? v * 1000 : v);
+
+function detectDelimiter(line) {
+  let best = 44;
+  let most = 0;
+  for (const d of [44, 59, 9]) {
+    const n = line.split(String.fromCharCode(d)).length - 1;
+    if (n > most) {
+      most = n;
+      best = d;
+    }
+  }
+  return best;
+}
+
+// column index -> row slot (-1: ignored), or null when the line is not a header
+function headerSlots(names) {
+  const slots = names.map((n) => ALIASES.findIndex((a) => a.includes(n.toLowerCase())));
+  if (slots.every((s) => s < 0)) return null;
+  // the first column claiming a slot wins ("Close" before "Adj Close"-style duplicates)
+  const seen = new Set();
+  const out = slots.map((s) => {
+    if (s < 0 || seen.has(s)) return -1;
+    seen.add(s);
+    return s;
+  });
+  const missing = ["time", "open", "high", "low", "close"].filter((_, k) => !seen.has(k));
+  if (missing.length) throw new Error(`CSV header is missing ${missing.join(", ")}`);
+  return out;
+}
+
+export function createCandleParser({ capacity = 4096 } = {}) {
+  let slots = null; // Int8Array, column -> slot
+  let delim = 44;
+  let series = null;
+  let width = 0; // slots filled per row: 5, or 6 with volume
+  let carry = new Uint8Array(0); // bytes of the unfinished last line
+  let bytes = 0;
+  let skipped = 0;
+  let ascending = true;
+  let descending = true;
+  const row = new Float64Array(6);
+
+  function start(headerLine) {
+    delim = detectDelimiter(headerLine);
+    const names = headerLine.split(String.fromCharCode(delim)).map(clean);
+    const named = headerSlots(names);
+    slots = Int8Array.from(named || names.map((_, k) => (k < ALIASES.length ? k : -1)));
+    width = slots.includes(5) ? 6 : 5;
+    series = createSeries(FIELDS.slice(0, width - 1), capacity);
+    return !named; // a headerless first line is data
+  }
+
+  // a field that is not a plain decimal: ISO time, exponent, quotes, thousands separators
+  function slowField(b, from, to, slot) {
+    if (slot === T) return isoTime(b, from, to) ? scratch[0] : NaN;
+    const field = text.decode(b.subarray(from, to));
+    // "1,234.5" in a comma file; a decimal comma (1,5) in a ; or tab one
+    return parseFloat(delim === 44 ? field.replace(/[",]/g, "") : field.replace(/"/g, "").replace(",", "."));
+  }
+
+  // complete lines in b[i, end): every line, the last included, ends in a newline
+  function parse(b, i, end) {
+    const cols = FIELDS.slice(0, width - 1).map((f) => series.cols[f]);
+    const nslots = slots.length;
+    let ts = series.t;
+    let cap = ts.length;
+    let n = series.length;
+    let prevT = n ? ts[n - 1] : -Infinity;
+
+    while (i < end) {
+      let c = b[i];
+      if (c === NL || (c === CR && b[i + 1] === NL)) {
+        i += c === NL ? 1 : 2; // empty line
+        continue;
+      }
+      row.fill(NaN);
+      for (let col = 0; ; col++) {
+        const from = i;
+        // fast path: [-]digits[.digits], straight to the delimiter
+        const neg = c === 45;
+        if (neg) c = b[++i];
+        let num = 0;
+        let digits = 0;
+        let div = 1;
+        for (; c >= 48 && c <= 57; c = b[++i], digits++) num = num * 10 + (c - 48);
+        if (c === 46) for (c = b[++i]; c >= 48 && c <= 57; c = b[++i], digits++, div *= 10) num = num * 10 + (c - 48);
+        const slot = col < nslots ? slots[col] : -1;
+        if ((c === delim || c === NL || c === CR) && digits <= MAX_EXACT_DIGITS) {
+          if (slot >= 0 && digits) row[slot] = slot === T ? toMs((neg ? -num : num) / div) : (neg ? -num : num) / div;
+        } else {
+          for (let quoted = false; c !== NL && (c !== delim || quoted); c = b[++i]) if (c === QUOTE) quoted = !quoted;
+          if (slot >= 0) row[slot] = slowField(b, from, i, slot);
+        }
+        while (c === CR) c = b[++i];
+        c = b[++i]; // past the delimiter or newline
+        if (b[i - 1] === NL) break;
+      }
+      const t = row[T];
+      if (!(t === t && row[1] === row[1] && row[2] === row[2] && row[3] === row[3] && row[4] === row[4])) {
+        skipped++;
+        continue;
+      }
+      if (n === cap) {
+        series.length = n;
+        reserve(series, n + 1);
+        ts = series.t;
+        cap = ts.length;
+        for (let k = 0; k < cols.length; k++) cols[k] = series.cols[FIELDS[k]];
+      }
+      ts[n] = t;
+      for (let k = 0; k < cols.length; k++) cols[k][n] = row[k + 1] === row[k + 1] ? row[k + 1] : 0;
+      if (t < prevT) ascending = false;
+      else if (t > prevT && n) descending = false;
+      prevT = t;
+      n++;
+    }
+    series.length = n;
+  }
+
+  const lastNewline = (b) => {
+    for (let k = b.length - 1; k >= 0; k--) if (b[k] === NL) return k;
+    return -1;
+  };
+
+  const join = (a, b) => {
+    const out = new Uint8Array(a.length + b.length);
+    out.set(a);
+    out.set(b, a.length);
+    return out;
+  };
+
+  function push(chunk) {
+    bytes += chunk.length;
+    const nl = chunk.indexOf(NL);
+    if (nl < 0) {
+      carry = join(carry, chunk);
+      return;
+    }
+    let from = 0;
+    if (carry.length || !slots) {
+      // only the line straddling the previous chunk is copied, never the chunk itself
+      const line = join(carry, chunk.subarray(0, nl + 1));
+      from = nl + 1;
+      if (slots || start(text.decode(line.subarray(0, line.length - 1)))) parse(line, 0, line.length);
+    }
+    const cut = lastNewline(chunk) + 1;
+    if (cut > from) parse(chunk, from, cut);
+    carry = chunk.slice(cut);
+  }
+
+  function end() {
+    if (!slots && carry.length && !start(text.decode(carry))) carry = new Uint8Array(0);
+    if (!series) throw new Error("CSV file is empty");
+    if (carry.length) parse(join(carry, [NL]), 0, carry.length + 1);
+    carry = new Uint8Array(0);
+    series.version++;
+    if (!ascending) order();
+    return series;
+  }
+
+  // newest-first vendor exports are reversed in place; anything else is sorted by time
+  function order() {
+    const n = series.length;
+    const cols = [series.t, ...series.fields.map((f) => series.cols[f])];
+    if (descending) {
+      cols.forEach((c) => c.subarray(0, n).reverse());
+      return;
+    }
+    const idx = new Uint32Array(n);
+    for (let k = 0; k < n; k++) idx[k] = k;
+    const t = series.t;
+    idx.sort((a, b) => t[a] - t[b] || a - b);
+    cols.forEach((c) => {
+      const copy = c.slice(0, n);
+      for (let k = 0; k < n; k++) c[k] = copy[idx[k]];
+    });
+  }
+
+  return {
+    push,
+    end,
+    // rows parsed so far, for pre-sizing once the average row width is known
+    reserve: (rows) => series && reserve(series, rows),
+    stats: () => ({ bytes, rows: series ? series.length : 0, skipped }),
+  };
+}
+
+const SLICE = 4 << 20;
+
+/**
+ * Parses a File/Blob slice by slice; only one slice is held at a time, so memory is the columns
+ * plus one slice whatever the file size. onProgress({ bytes, total, rows, skipped }) follows
+ * each slice and cancelled() is polled between them.
+ * Resolves { series, bytes, rows, skipped }, or null once cancelled.
+ */
+export async function parseCandleFile(file, { onProgress, cancelled = () => false, slice = SLICE } = {}) {
+  const parser = createCandleParser();
+  for (let off = 0; off < file.size; off += slice) {
+    const chunk = new Uint8Array(await file.slice(off, off + slice).arrayBuffer());
+    if (cancelled()) return null;
+    parser.push(chunk);
+    // size the columns once from the first slice's row width instead of doubling up to millions
+    if (off === 0 && file.size > slice) parser.reserve(Math.ceil(((parser.stats().rows * file.size) / slice) * 1.02));
+    if (onProgress) onProgress({ ...parser.stats(), total: file.size });
+  }
+  const series = parser.end();
+  return { series, ...parser.stats() };
+}
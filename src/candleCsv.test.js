@@ -0,0 +1,55 @@
+import { createCandleParser, parseIsoTime } from './candleCsv';
+
+const bytes = (s) => new TextEncoder().encode(s);
+const parse = (csv, step = csv.length) => {
+  const p = createCandleParser({ capacity: 2 });
+  const b = bytes(csv);
+  for (let i = 0; i < b.length; i += step) p.push(b.subarray(i, i + step));
+  const s = p.end();
+  return { s, stats: p.stats(), t: Array.from(s.t.subarray(0, s.length)), col: (f) => Array.from(s.cols[f].subarray(0, s.length)) };
+};
+
+const VENDOR = [
+  'Date,Open,High,Low,Close,Adj Close,Volume',
+  '2024-01-03,3,4,2,3.5,3.4,100',
+  '2024-01-02,2,3,1,2.5,2.4,"1,200"',
+  '',
+  'n/a,1,2,3,4,5,6',
+  '2024-01-01T12:30:00+01:00,1e0,2,0.5,1.25,1,',
+].join('\r\n');
+
+test('reads a named header in any column order, whatever the chunking', () => {
+  for (const step of [1, 2, 7, 64, 1 << 16]) {
+    const { s, stats, t, col } = parse(VENDOR, step);
+    expect(s.fields).toEqual(['o', 'h', 'l', 'c', 'v']);
+    // newest-first input comes out ascending; the unreadable time is skipped, the blank line ignored
+    expect(t).toEqual([Date.UTC(2024, 0, 1, 11, 30), Date.UTC(2024, 0, 2), Date.UTC(2024, 0, 3)]);
+    expect(col('o')).toEqual([1, 2, 3]);
+    expect(col('c')).toEqual([1.25, 2.5, 3.5]); // Close, not Adj Close
+    expect(col('v')).toEqual([0, 1200, 100]);
+    expect(stats).toEqual({ bytes: VENDOR.length, rows: 3, skipped: 1 });
+  }
+});
+
+test('headerless files are t,o,h,l,c with epoch seconds or ms and a sniffed delimiter', () => {
+  const { s, t, col } = parse('1704067200;1,5;2;0.5;1.5\n1704153600000;2;3;1;2');
+  expect(s.fields).toEqual(['o', 'h', 'l', 'c']);
+  expect(t).toEqual([1704067200000, 1704153600000]);
+  expect(col('o')).toEqual([1.5, 2]); // decimal comma
+  expect(col('c')).toEqual([1.5, 2]);
+});
+
+test('unordered rows are sorted and a header without prices is rejected', () => {
+  expect(parse('t\to\th\tl\tc\n3\t1\t1\t1\t3\n1\t1\t1\t1\t1\n2\t1\t1\t1\t2\n').col('c')).toEqual([1, 2, 3]);
+  expect(() => parse('date,open,close\n2024-01-01,1,2\n')).toThrow('missing high, low');
+  expect(() => createCandleParser().end()).toThrow('empty');
+});
+
+test('ISO 8601 times', () => {
+  const iso = (s) => parseIsoTime(bytes(s));
+  expect(iso('2024-02-29')).toBe(Date.UTC(2024, 1, 29));
+  expect(iso('1969-12-31 23:59:59.5Z')).toBe(-500);
+  expect(iso('"2024-06-01T09:30-0400"')).toBe(Date.UTC(2024, 5, 1, 13, 30));
+  expect(iso('2024-13-01')).toBeNaN();
+  expect(iso('2024-01-01T09:3x')).toBeNaN();
+});
@@ -0,0 +1,95 @@
+import { useCallback, useEffect, useRef, useState } from "react";
+import { spawnCandleImportWorker } from "./workers";
+import { parseCandleFile } from "./candleCsv";
+
+/**
+ * Main-thread side of the candle import worker.
+ * importCandles(file, { onProgress, signal }) resolves { series, rows, skipped, bytes, ms } with a
+ * seriesStore series; aborting `signal` stops the read and rejects with an AbortError. Without
+ * workers the same slice-by-slice parse runs here.
+ * useCandleImport(onSeries) drives a file input: progress state plus start(file) / cancel().
+ */
+
+let worker;
+let seq = 0;
+const jobs = new Map(); // id -> { resolve, reject, onProgress }
+
+const aborted = () => new DOMException("Import cancelled", "AbortError");
+
+function getWorker() {
+  if (worker === undefined) {
+    worker = spawnCandleImportWorker();
+    if (worker) {
+      worker.onmessage = ({ data }) => {
+        const job = jobs.get(data.id);
+        if (!job) return;
+        if (data.type === "progress") {
+          if (job.onProgress) job.onProgress(data);
+          return;
+        }
+        jobs.delete(data.id);
+        if (data.type === "done") {
+          const { series, rows, skipped, bytes, ms } = data;
+          job.resolve({ series: { ...series, version: 0 }, rows, skipped, bytes, ms });
+        } else if (data.type === "cancelled") job.reject(aborted());
+        else job.reject(new Error(data.message));
+      };
+    }
+  }
+  return worker;
+}
+
+export function importCandles(file, { onProgress, signal } = {}) {
+  if (signal && signal.aborted) return Promise.reject(aborted());
+  const w = getWorker();
+  if (!w) {
+    const t0 = performance.now();
+    return parseCandleFile(file, { onProgress, cancelled: () => !!(signal && signal.aborted) }).then((out) => {
+      if (!out) throw aborted();
+      return { ...out, ms: performance.now() - t0 };
+    });
+  }
+  const id = ++seq;
+  return new Promise((resolve, reject) => {
+    jobs.set(id, { resolve, reject, onProgress });
+    if (signal) signal.addEventListener("abort", () => jobs.has(id) && w.postMessage({ type: "cancel", id }), { once: true });
+    w.postMessage({ type: "import", id, file });
+  });
+}
+
+// state: { status: "idle" } | { status: "reading", name, bytes, total, rows }
+//        | { status: "done", name, rows, skipped, ms } | { status: "error", message }
+export function useCandleImport(onSeries) {
+  const [state, setState] = useState({ status: "idle" });
+  const running = useRef(null); // AbortController of the import in flight
+  useEffect(() => () => running.current && running.current.abort(), []);
+
+  const start = useCallback(
+    (file) => {
+      if (running.current) running.current.abort();
+      const ctrl = new AbortController();
+      running.current = ctrl;
+      setState({ status: "reading", name: file.name, bytes: 0, total: file.size, rows: 0 });
+      const mine = () => running.current === ctrl; // a newer import owns the state
+      importCandles(file, {
+        signal: ctrl.signal,
+        onProgress: ({ bytes, rows }) => mine() && setState((s) => ({ ...s, bytes, rows })),
+      }).then(
+        ({ series, rows, skipped, ms }) => {
+          if (!mine()) return;
+          running.current = null;
+          setState({ status: "done", name: file.name, rows, skipped, ms });
+          onSeries(series);
+        },
+        (e) => {
+          if (!mine()) return;
+          running.current = null;
+          setState(e.name === "AbortError" ? { status: "idle" } : { status: "error", message: e.message });
+        }
+      );
+    },
+    [onSeries]
+  );
+  const cancel = useCallback(() => running.current && running.current.abort(), []);
+  return { ...state, start, cancel };
+}
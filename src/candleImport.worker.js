@@ -0,0 +1,52 @@
+/* eslint-disable no-restricted-globals */
+import { parseCandleFile } from "./candleCsv";
+
+/**
+ * Candle import worker: parses a user's OHLCV CSV into columns off the main thread
+ *   in:  { type: "import", id, file } | { type: "cancel", id }
+ *   out: { type: "progress", id, bytes, total, rows, skipped }
+ *        { type: "done", id, series: { fields, t, cols, length }, bytes, rows, skipped, ms }
+ *        { type: "cancelled", id } | { type: "error", id, message }
+ * The finished columns are transferred, not copied. A new import cancels the running one.
+ */
+
+let current = null; // { id, cancelled }
+
+// capacity left over from growth is dropped before the transfer once it is a quarter of the data
+const trim = (s) => {
+  if (s.t.length <= s.length * 1.25) return s;
+  const cols = {};
+  s.fields.forEach((f) => (cols[f] = s.cols[f].slice(0, s.length)));
+  return { ...s, t: s.t.slice(0, s.length), cols };
+};
+
+async function run(id, file) {
+  if (current) current.cancelled = true;
+  const job = { id, cancelled: false };
+  current = job;
+  const t0 = performance.now();
+  try {
+    const out = await parseCandleFile(file, {
+      cancelled: () => job.cancelled,
+      onProgress: (p) => self.postMessage({ type: "progress", id, ...p }),
+    });
+    if (!out) {
+      self.postMessage({ type: "cancelled", id });
+      return;
+    }
+    const { fields, t, cols, length } = trim(out.series);
+    self.postMessage(
+      { type: "done", id, series: { fields, t, cols, length }, bytes: out.bytes, rows: out.rows, skipped: out.skipped, ms: performance.now() - t0 },
+      [t.buffer, ...fields.map((f) => cols[f].buffer)]
+    );
+  } catch (e) {
+    self.postMessage({ type: "error", id, message: e.message });
+  } finally {
+    if (current === job) current = null;
+  }
+}
+
+self.onmessage = ({ data }) => {
+  if (data.type === "import") run(data.id, data.file);
+  else if (data.type === "cancel" && current && current.id === data.id) current.cancelled = true;
+};
@@ -0,0 +1,185 @@
+import { useMemo, useSyncExternalStore } from "react";
+import { fetchEntities } from "./api";
+
+/**
+ * Normalized entity store (instruments, positions, accounts)
+ * - One record per `type:id`; widgets hold ids, never copies
+ * - Reads of missing entities made in the same tick are batched into one fetchEntities() round
+ *   trip (the mock server answers GraphQL-style, including related entities); ids already
+ *   present or in flight are never requested again
+ * - Selectors record which records they read; merging a record bumps its version and wakes only
+ *   the selectors that read it, and a record that arrives unchanged wakes nobody
+ */
+
+const keyOf = (type, id) => `${type}:${id}`;
+
+const shallowEqual = (a, b) => {
+  if (a === b) return true;
+  if (!a || !b) return false;
+  const ka = Object.keys(a);
+  if (ka.length !== Object.keys(b).length) return false;
+  return ka.every((k) => a[k] === b[k] || (Array.isArray(a[k]) && Array.isArray(b[k]) && a[k].length === b[k].length && a[k].every((x, i) => x === b[k][i])));
+};
+
+export function createEntityStore({ fetchBatch = fetchEntities, schedule = (fn) => Promise.resolve().then(fn) } = {}) {
+  const records = new Map(); // key -> { value, version }
+  const listeners = new Map(); // key -> Set<fn>
+  const inflight = new Set(); // keys requested and not yet answered
+  let queue = null; // type -> Set<id>, flushed once per tick
+  const counts = { roundTrips: 0, requested: 0, hits: 0, misses: 0 };
+
+  const versionOf = (key) => (records.has(key) ? records.get(key).version : 0);
+
+  function flush() {
+    const batch = {};
+    queue.forEach((ids, type) => (batch[type] = Array.from(ids)));
+    queue = null;
+    counts.roundTrips++;
+    const keys = Object.keys(batch).flatMap((type) => batch[type].map((id) => keyOf(type, id)));
+    const done = () => keys.forEach((k) => inflight.delete(k));
+    return Promise.resolve(fetchBatch(batch)).then(
+      (payload) => {
+        done();
+        merge(payload);
+      },
+      (err) => {
+        done(); // the next read retries
+        if (typeof console !== "undefined") console.warn("entity batch failed", err);
+      }
+    );
+  }
+
+  function request(type, id) {
+    const key = keyOf(type, id);
+    if (inflight.has(key)) return;
+    inflight.add(key);
+    counts.requested++;
+    if (!queue) {
+      queue = new Map();
+      schedule(flush);
+    }
+    if (!queue.has(type)) queue.set(type, new Set());
+    queue.get(type).add(id);
+  }
+
+  /** payload: { [type]: [entity with `id`] }; returns the keys that actually changed. */
+  function merge(payload) {
+    const changed = [];
+    Object.keys(payload || {}).forEach((type) =>
+      payload[type].forEach((entity) => {
+        const key = keyOf(type, entity.id);
+        const rec = records.get(key);
+        if (rec && shallowEqual(rec.value, entity)) return;
+        records.set(key, { value: Object.freeze({ ...entity }), version: versionOf(key) + 1 });
+        changed.push(key);
+      })
+    );
+    changed.forEach((key) => (listeners.get(key) || []).forEach((l) => l()));
+    return changed;
+  }
+
+  // plain read: cached value or undefined (and a batched fetch)
+  function get(type, id) {
+    const rec = records.get(keyOf(type, id));
+    if (rec) {
+      counts.hits++;
+      return rec.value;
+    }
+    counts.misses++;
+    request(type, id);
+    return undefined;
+  }
+
+  function subscribeKey(key, fn) {
+    if (!listeners.has(key)) listeners.set(key, new Set());
+    listeners.get(key).add(fn);
+    return () => {
+      const set = listeners.get(key);
+      set.delete(fn);
+      if (!set.size) listeners.delete(key);
+    };
+  }
+
+  /**
+   * select(read) -> value, where read(type, id) is `get` plus dependency tracking.
+   * Returns { get, subscribe } for useSyncExternalStore; the value is recomputed only after a record
+   * it read changed, and it stays referentially stable otherwise.
+   */
+  function selector(select) {
+    let deps = new Map(); // key -> version seen
+    let value;
+    let computed = false;
+    let notify = null;
+    const unsubs = new Map();
+
+    const resubscribe = () => {
+      if (!notify) return;
+      unsubs.forEach((off, key) => {
+        if (!deps.has(key)) {
+          off();
+          unsubs.delete(key);
+        }
+      });
+      deps.forEach((_, key) => unsubs.has(key) || unsubs.set(key, subscribeKey(key, notify)));
+    };
+    const read = (type, id) => {
+      const key = keyOf(type, id);
+      const v = get(type, id);
+      deps.set(key, versionOf(key));
+      return v;
+    };
+    const stale = () => !computed || Array.from(deps).some(([key, seen]) => versionOf(key) !== seen);
+
+    return {
+      get() {
+        if (!stale()) return value;
+        deps = new Map();
+        value = select(read);
+        computed = true;
+        resubscribe();
+        return value;
+      },
+      subscribe(fn) {
+        notify = fn;
+        resubscribe();
+        return () => {
+          unsubs.forEach((off) => off());
+          unsubs.clear();
+          notify = null;
+        };
+      },
+    };
+  }
+
+  return {
+    get,
+    merge,
+    selector,
+    prefetch: (type, ids) => ids.forEach((id) => records.has(keyOf(type, id)) || request(type, id)),
+    // fetch again even when present (records restored from a snapshot); unchanged ones wake nobody
+    refresh: (type, ids) => ids.forEach((id) => request(type, id)),
+    /** Every record of `types` as a merge() payload. */
+    dump(types) {
+      const payload = Object.fromEntries(types.map((t) => [t, []]));
+      records.forEach((rec, key) => {
+        const type = key.slice(0, key.indexOf(":"));
+        if (payload[type]) payload[type].push(rec.value);
+      });
+      return payload;
+    },
+    stats: () => ({ ...counts, records: records.size }),
+  };
+}
+
+export const entityStore = createEntityStore();
+
+// ---------- hooks
+// `select(read)` re-runs only when an entity it read changes; `deps` are the selector's own inputs.
+export function useSelector(select, deps = [], store = entityStore) {
+  // eslint-disable-next-line react-hooks/exhaustive-deps
+  const sel = useMemo(() => store.selector(select), [store, ...deps]);
+  return useSyncExternalStore(sel.subscribe, sel.get);
+}
+
+// entities for `ids` in order (undefined while loading); stable until one of them changes
+export const useEntities = (type, ids, store = entityStore) => useSelector((read) => ids.map((id) => read(type, id)), [type, ids.join(",")], store);
@@ -0,0 +1,43 @@
+import { createEntityStore } from './entityStore';
+
+const tick = () => new Promise((r) => setTimeout(r, 0));
+
+function setup() {
+  const batches = [];
+  const db = { AAPL: { id: 'AAPL', name: 'Apple Inc.' }, MSFT: { id: 'MSFT', name: 'Microsoft Corp.' } };
+  const fetchBatch = (batch) => {
+    batches.push(batch);
+    return Promise.resolve({ instrument: (batch.instrument || []).map((id) => db[id]) });
+  };
+  return { store: createEntityStore({ fetchBatch }), batches };
+}
+
+test('reads in the same tick share one round trip and repeats hit the cache', async () => {
+  const { store, batches } = setup();
+  expect(store.get('instrument', 'AAPL')).toBeUndefined();
+  expect(store.get('instrument', 'MSFT')).toBeUndefined();
+  expect(store.get('instrument', 'AAPL')).toBeUndefined(); // already in flight
+  await tick();
+  expect(batches).toEqual([{ instrument: ['AAPL', 'MSFT'] }]);
+  expect(store.get('instrument', 'AAPL').name).toBe('Apple Inc.');
+  expect(store.stats()).toMatchObject({ roundTrips: 1, requested: 2 });
+});
+
+test('an update wakes only the selectors that read the changed record', async () => {
+  const { store } = setup();
+  const apple = store.selector((read) => read('instrument', 'AAPL'));
+  const msft = store.selector((read) => read('instrument', 'MSFT'));
+  let woke = [];
+  apple.subscribe(() => woke.push('apple'));
+  msft.subscribe(() => woke.push('msft'));
+  apple.get();
+  msft.get();
+  await tick();
+  expect(woke.sort()).toEqual(['apple', 'msft']); // both arrived
+  const before = msft.get();
+  woke = [];
+  store.merge({ instrument: [{ id: 'AAPL', name: 'Apple' }, { id: 'MSFT', name: 'Microsoft Corp.' }] });
+  expect(woke).toEqual(['apple']); // MSFT arrived unchanged
+  expect(apple.get().name).toBe('Apple');
+  expect(msft.get()).toBe(before);
+});
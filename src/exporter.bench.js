@@ -0,0 +1,63 @@
+/**
+ * @jest-environment node
+ */
+import v8 from 'v8';
+import { toStream, csvSeriesChunks } from './exporter';
+import { encodeSeriesChunks } from './snapshot';
+import { createSeries, reserve } from './seriesStore';
+
+// npm run bench -- exporter   (not part of `npm test`; node environment for ReadableStream)
+// Streams a 10M-point candle series out as CSV (ISO and epoch times) and as the binary snapshot
+// format into a sink that only counts bytes, sampling the JS heap at every chunk. Peak heap growth
+// has to stay flat: bounded by per-chunk garbage (young generation), not by the size of the output.
+const ROWS = 10000000;
+const MB = 1 << 20;
+
+let seed = 3;
+const rnd = () => ((seed = (seed * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+
+function makeSeries() {
+  const s = reserve(createSeries(['o', 'h', 'l', 'c']), ROWS);
+  const { o, h, l, c } = s.cols;
+  let px = 100;
+  for (let i = 0; i < ROWS; i++) {
+    s.t[i] = Date.UTC(2000, 0, 1) + i * 60000;
+    o[i] = px;
+    px = Math.max(1, Math.round(px * (1 + (rnd() - 0.5) * 0.01) * 100) / 100);
+    h[i] = Math.max(o[i], px) + 0.05;
+    l[i] = Math.min(o[i], px) - 0.05;
+    c[i] = px;
+  }
+  s.length = ROWS;
+  return s;
+}
+
+const heap = () => v8.getHeapStatistics().used_heap_size;
+let series;
+beforeAll(() => {
+  series = makeSeries();
+});
+
+test.each([
+  ['csv, ISO times', () => csvSeriesChunks(series)],
+  ['csv, epoch times', () => csvSeriesChunks(series, { time: 'epoch' })],
+  ['binary', () => encodeSeriesChunks('bench', series)],
+])(`export ${ROWS} rows, %s`, async (label, chunks) => {
+  global.gc && global.gc();
+  const h0 = heap();
+  let peak = 0;
+  let bytes = 0;
+  const t0 = performance.now();
+  const reader = toStream(chunks()).getReader();
+  for (;;) {
+    const { value, done } = await reader.read();
+    if (done) break;
+    bytes += value.length;
+    peak = Math.max(peak, heap() - h0);
+  }
+  const ms = performance.now() - t0;
+  console.log(
+    JSON.stringify({ bench: 'exporter', format: label, rows: ROWS, outMB: Math.round(bytes / MB), ms: Math.round(ms), mbPerSec: Math.round(bytes / MB / (ms / 1000)), peakHeapGrowthMB: +(peak / MB).toFixed(1) }, null, 2)
+  );
+  expect(peak).toBeLessThan(64 * MB);
+}, 600000);
@@ -0,0 +1,130 @@
+import { encodeSeriesChunks } from "./snapshot";
+
+/**
+ * Streaming export of tables and series to a file
+ * - csvSeriesChunks / csvRowsChunks (and snapshot.js's encodeSeriesChunks for the binary form)
+ *   yield Uint8Array chunks of CHUNK_ROWS rows; no string or buffer ever holds the whole file
+ * - toStream() encodes the next chunk only when the reader asks for one, so a slow disk throttles
+ *   the encoder instead of chunks piling up, and yields to the event loop every SLICE_MS
+ * - saveStream() pipes to a file the user picks (File System Access API); without it the stream
+ *   is collected into a Blob, which browsers keep outside the JS heap, and downloaded from there
+ */
+
+const CHUNK_ROWS = 8192;
+const SLICE_MS = 8;
+const DAY = 86400000;
+// seriesStore field -> CSV column, spelled the way candleCsv.js (and most tools) read them back
+const COLUMN = { o: "open", h: "high", l: "low", c: "close", v: "volume" };
+
+const utf8 = new TextEncoder();
+const num = (v) => (Number.isFinite(v) ? String(v) : "");
+const cell = (v) => {
+  if (typeof v === "number") return num(v);
+  const s = v == null ? "" : String(v);
+  return /[",\r\n]/.test(s) ? `"${s.replace(/"/g, '""')}"` : s;
+};
+
+// "2024-04-05T09:30:00Z"; the date part is formatted once per day, not once per row
+function isoFormatter() {
+  let day = NaN;
+  let date = "";
+  const p2 = (n) => (n < 10 ? "0" + n : "" + n);
+  return (t) => {
+    if (t % 1000) return new Date(t).toISOString();
+    const d = Math.floor(t / DAY);
+    if (d !== day) {
+      day = d;
+      date = new Date(d * DAY).toISOString().slice(0, 11);
+    }
+    const s = (t - d * DAY) / 1000;
+    return date + p2(Math.floor(s / 3600)) + ":" + p2(Math.floor(s / 60) % 60) + ":" + p2(s % 60) + "Z";
+  };
+}
+
+// time: "iso" | "epoch" (ms). The first s.length points are exported, even if the series grows meanwhile
+export function* csvSeriesChunks(s, { time = "iso", chunkRows = CHUNK_ROWS } = {}) {
+  const fmtTime = time === "iso" ? isoFormatter() : num;
+  const n = s.length;
+  yield utf8.encode(["time", ...s.fields.map((f) => COLUMN[f] || f)].join(",") + "\n");
+  for (let i = 0; i < n; i += chunkRows) {
+    // re-read per chunk: an append may have moved the columns to bigger arrays
+    const t = s.t;
+    const cols = s.fields.map((f) => s.cols[f]);
+    const end = Math.min(n, i + chunkRows);
+    let out = "";
+    for (let k = i; k < end; k++) {
+      out += fmtTime(t[k]);
+      for (let c = 0; c < cols.length; c++) out += "," + num(cols[c][k]);
+      out += "\n";
+    }
+    yield utf8.encode(out);
+  }
+}
+
+// columns: [{ key, label }]; strings are quoted only where CSV needs it
+export function* csvRowsChunks(rows, columns, { chunkRows = CHUNK_ROWS } = {}) {
+  yield utf8.encode(columns.map((c) => cell(c.label || c.key)).join(",") + "\n");
+  for (let i = 0; i < rows.length; i += chunkRows) {
+    let out = "";
+    for (let k = i, end = Math.min(rows.length, i + chunkRows); k < end; k++) {
+      const r = rows[k];
+      for (let c = 0; c < columns.length; c++) out += (c ? "," : "") + cell(r[columns[c].key]);
+      out += "\n";
+    }
+    yield utf8.encode(out);
+  }
+}
+
+const nextTask = () => new Promise((r) => setTimeout(r, 0));
+
+export function toStream(chunks) {
+  const it = chunks[Symbol.iterator]();
+  let sliceStart = 0;
+  return new ReadableStream({
+    async pull(ctrl) {
+      // a fast sink pulls back to back; give input and paint a turn now and then
+      if (performance.now() - sliceStart > SLICE_MS) {
+        await nextTask();
+        sliceStart = performance.now();
+      }
+      const { value, done } = it.next();
+      if (done) ctrl.close();
+      else ctrl.enqueue(value);
+    },
+    cancel() {
+      if (it.return) it.return();
+    },
+  });
+}
+
+// resolves true once written, false if the user dismissed the save dialog
+export async function saveStream(stream, filename, type = "application/octet-stream") {
+  if (typeof window.showSaveFilePicker === "function") {
+    let handle;
+    try {
+      handle = await window.showSaveFilePicker({ suggestedName: filename });
+    } catch (e) {
+      stream.cancel();
+      if (e.name === "AbortError") return false;
+      throw e;
+    }
+    await stream.pipeTo(await handle.createWritable());
+    return true;
+  }
+  const blob = await new Response(stream, { headers: { "Content-Type": type } }).blob();
+  const url = URL.createObjectURL(blob);
+  const a = document.createElement("a");
+  a.href = url;
+  a.download = filename;
+  a.click();
+  setTimeout(() => URL.revokeObjectURL(url), 0);
+  return true;
+}
+
+// format: "csv" | "bin" (a snapshot.js file with this one series under `name`)
+export const exportSeries = (s, name, format = "csv") =>
+  format === "bin"
+    ? saveStream(toStream(encodeSeriesChunks(name, s)), `${name}.bin`)
+    : saveStream(toStream(csvSeriesChunks(s)), `${name}.csv`, "text/csv");
+
+export const exportRows = (rows, columns, name) => saveStream(toStream(csvRowsChunks(rows, columns)), `${name}.csv`, "text/csv");
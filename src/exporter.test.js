@@ -0,0 +1,39 @@
+import { csvRowsChunks, csvSeriesChunks } from './exporter';
+import { createCandleParser } from './candleCsv';
+import { fromRows } from './seriesStore';
+
+const text = (chunks) => {
+  const dec = new TextDecoder();
+  return [...chunks].map((c) => dec.decode(c)).join('');
+};
+
+const DAY = 86400000;
+const candles = fromRows([0, 1, 2, 3, 4], (i) => Date.UTC(2024, 3, 1) + i * DAY + (i === 4 ? 90500 : 0), ['o', 'h', 'l', 'c'], (i) => [i, i + 1.5, i - 0.25, i + 0.5]);
+
+test('series CSV is written CHUNK_ROWS rows at a time with readable column names', () => {
+  const chunks = [...csvSeriesChunks(candles, { chunkRows: 2 })];
+  expect(chunks.length).toBe(1 + 3);
+  const lines = text(chunks).split('\n');
+  expect(lines[0]).toBe('time,open,high,low,close');
+  expect(lines[1]).toBe('2024-04-01T00:00:00Z,0,1.5,-0.25,0.5');
+  expect(lines[5]).toBe('2024-04-05T00:01:30.500Z,4,5.5,3.75,4.5');
+  expect(text(csvSeriesChunks(candles, { time: 'epoch' })).split('\n')[1]).toBe(`${Date.UTC(2024, 3, 1)},0,1.5,-0.25,0.5`);
+});
+
+test('exported candles import back unchanged', () => {
+  const p = createCandleParser();
+  for (const c of csvSeriesChunks(candles, { chunkRows: 3 })) p.push(c);
+  const s = p.end();
+  expect(s.length).toBe(5);
+  expect(Array.from(s.t.subarray(0, 5))).toEqual(Array.from(candles.t));
+  expect(Array.from(s.cols.l.subarray(0, 5))).toEqual(Array.from(candles.cols.l));
+});
+
+test('table rows are quoted only where CSV needs it', () => {
+  const rows = [
+    { sym: 'BRK.B', name: 'Berkshire Hathaway, Inc.', price: 412.5 },
+    { sym: 'X', name: 'The "X" Co', price: NaN },
+  ];
+  const csv = text(csvRowsChunks(rows, [{ key: 'sym', label: 'Symbol' }, { key: 'name', label: 'Company' }, { key: 'price', label: 'Price' }]));
+  expect(csv).toBe('Symbol,Company,Price\nBRK.B,"Berkshire Hathaway, Inc.",412.5\nX,"The ""X"" Co",\n');
+});
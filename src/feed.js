@@ -0,0 +1,207 @@
+import { useEffect, useLayoutEffect, useRef, useState, useSyncExternalStore } from "react";
+import { connectFeed } from "./feedHub";
+import { parseRule } from "./alertExpr";
+import { telemetry } from "./telemetry";
+import { tickLatency, epochUs } from "./tickLatency";
+import { perfHud } from "./perfHud";
+import { warmStart } from "./warmStart";
+import { prefs } from "./prefs";
+
+/**
+ * Main-thread side of feed.worker.js
+ * - usePriceFeed(symbols, minUpdateMs): prices pushed by the worker, committed in rAF and
+ *   throttled by the render governor; falls back to a main-thread walk without workers
+ * - The worker is shared by all open tabs (feedHub.js): one connection for their symbols together
+ * - Prices start from the warm-start snapshot (warmStart.js) when there is one; latestPrices()
+ *   is what the next snapshot saves
+ * - Feed stats, gateway connection state and gateway metrics go to telemetry.js (System Health);
+ *   tick-to-paint stage stamps go to tickLatency.js, and the commit / paint stages are taken here
+ * - Alerts: the worker owns the rule list and sends it to every tab on each change; a tab shows it,
+ *   and the one the worker names persists it as the fs:alerts pref (prefs.js: written at idle time),
+ *   which seeds the list the next time a worker starts.
+ *   Fired batches land in a small store that drives the Bell badge and notification list (useAlerts)
+ */
+
+const RULES_KEY = "fs:alerts";
+const MAX_ITEMS = 50;
+
+let worker;
+const priceListeners = new Set();
+let lastPrices = {};
+export const latestPrices = () => lastPrices;
+
+// ---------- alert store
+let alertState = { unread: 0, items: [], rules: prefs.get(RULES_KEY, []), book: null, error: null };
+const alertListeners = new Set();
+
+const setAlertState = (patch) => {
+  alertState = { ...alertState, ...patch };
+  alertListeners.forEach((l) => l());
+};
+
+// only the authoritative list is persisted: the worker's (by the one tab it asks to), or this
+// tab's own when there is no worker
+const setRules = (rules, patch, save = true) => {
+  setAlertState({ ...patch, rules });
+  if (save) prefs.set(RULES_KEY, rules);
+};
+
+// the stored list arrives with prefs.load(); a worker that started before it gets what it lacks
+prefs.subscribe(RULES_KEY, () => {
+  const rules = prefs.get(RULES_KEY, []);
+  if (rules === alertState.rules) return; // our own setRules
+  setAlertState({ rules });
+  if (worker) rules.forEach((alert) => worker.postMessage({ type: "alert:add", alert }));
+});
+
+// `rules` comes along (fired one-shots already gone) only when the list changed
+function onFired({ fired, total, book, rules, save }) {
+  const patch = {
+    unread: alertState.unread + total,
+    items: fired.slice().reverse().concat(alertState.items).slice(0, MAX_ITEMS),
+    book,
+  };
+  if (rules) setRules(rules, patch, !!save);
+  else setAlertState(patch);
+}
+
+function onWorkerMessage(data) {
+  if (data.type === "prices") {
+    if (data.stats) telemetry.feed(data.stats);
+    if (data.trace) tickLatency.pushed(data.trace);
+    lastPrices = data.prices;
+    priceListeners.forEach((l) => l(data.prices));
+  } else if (data.type === "ws") telemetry.connection(data.state);
+  else if (data.type === "metrics") telemetry.gatewayMetrics(data.m);
+  else if (data.type === "alerts") onFired(data);
+  else if (data.type === "rules") setRules(data.rules, null, !!data.save);
+  else if (data.type === "alert:error") setAlertState({ error: data.message, rules: alertState.rules.filter((r) => r.key !== data.key) });
+}
+
+function getWorker(symbols) {
+  if (worker === undefined) {
+    // rebuilt each time the hub (re)connects, so a new worker gets today's rules and flags
+    const hello = () => ({
+      type: "init",
+      symbols,
+      seed: warmStart.prices(),
+      alerts: alertState.rules,
+      demoAlerts: Number(process.env.REACT_APP_DEMO_ALERTS) || 0,
+      gateway: process.env.REACT_APP_GATEWAY_URL || "",
+      metrics: telemetry.active(),
+      latency: tickLatency.enabled(),
+    });
+    worker = connectFeed({ hello, onMessage: onWorkerMessage });
+    if (worker) {
+      telemetry.onActive((on) => worker.postMessage({ type: "metrics", on }));
+      tickLatency.onEnabled((on) => worker.postMessage({ type: "latency", on }));
+      // a page kept in the bfcache stays attached; the worker re-inits it if it was dropped meanwhile
+      window.addEventListener("pagehide", (e) => e.persisted || worker.close());
+    }
+  }
+  return worker;
+}
+
+let nextKey = Date.now();
+export const alerts = {
+  subscribe(listener) {
+    alertListeners.add(listener);
+    return () => alertListeners.delete(listener);
+  },
+  getState: () => alertState,
+  // level alerts: { sym, kind: "above" | "below" | "cross", level }; rules: { sym, kind: "expr", expr }
+  add({ sym, kind, level, expr }) {
+    const key = `a${nextKey++}`;
+    let rule;
+    if (kind === "expr") {
+      try {
+        parseRule(expr); // fail fast in the form; the worker compiles its own copy
+      } catch (e) {
+        setAlertState({ error: e.message });
+        return false;
+      }
+      rule = { key, sym, kind, expr: expr.trim() };
+    } else {
+      rule = { key, sym, kind, level: +level };
+    }
+    // shown at once; with a worker its list (sent back to every tab) replaces this one
+    const next = alertState.rules.concat(rule);
+    if (worker) {
+      setAlertState({ rules: next, error: null });
+      worker.postMessage({ type: "alert:add", alert: rule });
+    } else setRules(next, { error: null });
+    return true;
+  },
+  remove(key) {
+    const next = alertState.rules.filter((r) => r.key !== key);
+    if (worker) {
+      setAlertState({ rules: next });
+      worker.postMessage({ type: "alert:remove", key });
+    } else setRules(next);
+  },
+  markRead: () => setAlertState({ unread: 0 }),
+};
+
+export const useAlerts = () => useSyncExternalStore(alerts.subscribe, alerts.getState);
+
+// ---------- prices
+// minUpdateMs throttles React commits only; the walk itself keeps ticking
+export function usePriceFeed(symbols, minUpdateMs = 0) {
+  const [prices, setPrices] = useState(() => {
+    const seed = warmStart.prices();
+    return Object.fromEntries(symbols.map((s) => [s, seed[s] || 100 + Math.random() * 50]));
+  });
+  const latest = useRef(prices);
+  useEffect(() => {
+    let raf;
+    let lastCommit = 0;
+    let shown = latest.current;
+    const commit = (next) => {
+      latest.current = next;
+      perfHud.queueAdd("feed", 1); // pushes waiting for a frame
+      const now = performance.now();
+      if (now - lastCommit < minUpdateMs || raf) telemetry.conflate();
+      if (now - lastCommit < minUpdateMs) return;
+      lastCommit = now;
+      cancelAnimationFrame(raf);
+      raf = requestAnimationFrame(() => {
+        raf = 0;
+        perfHud.queueSet("feed", 0);
+        if (telemetry.active()) telemetry.rendered(symbols.reduce((n, s) => n + (next[s] !== shown[s]), 0));
+        shown = next;
+        setPrices(next);
+      });
+    };
+    const w = getWorker(symbols);
+    let stop;
+    if (w) {
+      // behind the gateway a symbol is left out until its first tick; keep showing the placeholder
+      const onPrices = (p) => commit({ ...latest.current, ...p });
+      priceListeners.add(onPrices);
+      stop = () => priceListeners.delete(onPrices);
+    } else {
+      // no worker: the original main-thread walk, batched once per second
+      const id = setInterval(() => {
+        const next = { ...latest.current };
+        symbols.forEach((s) => {
+          const jitter = (Math.random() - 0.5) * 0.8;
+          next[s] = Math.max(1, next[s] + jitter);
+        });
+        if (telemetry.active()) telemetry.feed({ ticks: symbols.length, conflated: 0, lat: null });
+        if (tickLatency.enabled()) {
+          const at = epochUs();
+          tickLatency.pushed({ pushed: at, origins: symbols.map(() => at), stages: {} });
+        }
+        lastPrices = next;
+        commit(next);
+      }, 1000);
+      stop = () => clearInterval(id);
+    }
+    return () => {
+      cancelAnimationFrame(raf);
+      stop();
+    };
+  }, [symbols, minUpdateMs]);
+  useLayoutEffect(() => tickLatency.committed(), [prices]);
+  return prices;
+}
@@ -0,0 +1,411 @@
+/* eslint-disable no-restricted-globals */
+import { createAlertBook } from "./alertBook";
+import { createRuleSet } from "./alertExpr";
+import { createHistogram } from "./histogram";
+
+/**
+ * Feed worker: the price stream plus the alert engine, off the main thread, shared by every tab
+ * - Runs as a SharedWorker (one port per tab) or as a dedicated worker whose port carries several
+ *   tabs (feedHub.js's BroadcastChannel leader relays its followers); every message names its tab
+ *   and every reply is addressed to one
+ * - One stream for the union of the tabs' symbols, reference-counted: a symbol is subscribed
+ *   (gateway `sub`) when the first tab asks for it and dropped (`unsub`) when the last one leaves
+ * - Tabs ping every few seconds and say "bye" on pagehide; a tab silent for REAP_MS is dropped, and
+ *   told to re-init ("reinit") should it speak again
+ *   in:  { tab, type: "init", symbols, seed?, alerts: [{ key, sym, kind, level } | { key, sym?, kind: "expr", expr }], demoAlerts?, gateway?, metrics?, latency? }
+ *        { tab, type: "alert:add", alert } | { tab, type: "alert:remove", key }
+ *        { tab, type: "metrics", on }                       – System Health card shown / hidden
+ *        { tab, type: "latency", on }                       – tick-to-paint tracing (tickLatency.js)
+ *        { tab, type: "ping" } | { tab, type: "bye" }
+ *   out: { tab, type: "prices", prices: { [sym]: number }, ts, stats?, trace? } – once per PUSH_MS, the tab's
+ *          symbols only; with metrics on, stats = { ticks, conflated, lat } (ticks received, superseded
+ *          before the push, and gateway ingest -> worker latency [p50, p99, p999] in µs); with latency on,
+ *          trace = { pushed, origins, stages: { network, decode, conflation } } (µs, sparse histograms)
+ *        { tab, type: "alerts", fired: [...], total, book, rules?, save? } – to every tab, at most once per DEBOUNCE_MS;
+ *          rules only when a fired one-shot left the list
+ *        { tab, type: "rules", rules, save? }               – the rule list, to every tab whenever a tab changes it
+ *        { tab, type: "alert:error", key, message }         – to the tab that sent the rule
+ *        { tab, type: "reinit" }                            – unknown tab: send init again
+ *        { tab, type: "ws", state } | { tab, type: "metrics", m } – gateway connection state and its 1 Hz metrics frame
+ * Every tick runs through the level book, so level alerts see each price and not just the pushed ones.
+ * Expression rules (alertExpr.js) run on one OHLC bar per symbol per PUSH_MS. The worker owns the rule
+ * list: tabs send their changes, and the list is sent back to every tab, which shows it as is; one
+ * tab (`save`, the longest connected) persists it. A key already registered by another tab is not
+ * added twice.
+ * With `gateway` (a ws:// URL for server/gateway) ticks come from the gateway instead of the mock walk.
+ * `seed` (last known prices, warmStart.js) is where a symbol starts until its first tick. Behind the
+ * gateway a seed is only shown: bars and level alerts wait for the first real tick, and a symbol
+ * with neither is left out of `prices` until then.
+ */
+
+const TICK_MS = 100;
+const PUSH_MS = 1000;
+const DEBOUNCE_MS = 250;
+const MAX_BATCH = 50; // the Bell list only shows recent ones; `total` keeps the count exact
+const STEP = 0.8 / Math.sqrt(PUSH_MS / TICK_MS); // same per-second volatility as the old main-thread walk
+const RECONNECT_MS = [500, 1000, 2000, 5000, 10000];
+const REAP_MS = 75000; // outlasts Chrome's one-minute timer throttling of hidden tabs (feedHub.js PING_MS)
+const WORKER_STAGES = ["network", "decode", "conflation"]; // tickLatency.js takes it from there
+
+const book = createAlertBook();
+const rules = createRuleSet();
+const byKey = new Map(); // client key -> { set: book | rules, id }
+const ruleList = new Map(); // client key -> the rule as the tab sent it (demo alerts are not listed)
+const prices = {}; // the union of the tabs' symbols
+const bars = {}; // sym -> { open, high, low, close } for the bar in progress
+const refs = new Map(); // sym -> tabs subscribed
+const clients = new Map(); // port -> Map<tab, { port, tab, symbols, metrics, latency, seen }>
+let started = false;
+let gatewayUrl = "";
+let wsState = "mock";
+let fired = [];
+let rulesChanged = false; // a fired one-shot left ruleList since the last alerts batch
+let firedTotal = 0;
+let flushTimer = 0;
+let metricsOn = false;
+let ws = null;
+let ticks = 0;
+const latency = createHistogram();
+// tick-to-paint tracing: per-symbol origin and receive stamps of the latest tick, in epoch µs
+// (the same clock as tickLatency.epochUs; kept local so the worker bundle skips the page-side module)
+const epochUs = () => (performance.timeOrigin + performance.now()) * 1000;
+let traceOn = false;
+let originAt = {};
+let recvAt = {};
+const stages = Object.fromEntries(WORKER_STAGES.map((s) => [s, createHistogram()]));
+
+// ---------- tabs
+const send = (c, msg) => c.port.postMessage({ ...msg, tab: c.tab });
+const eachClient = (fn) => clients.forEach((tabs) => tabs.forEach(fn));
+const broadcast = (msg) => eachClient((c) => send(c, msg));
+// with the rule list, which one tab (the first, i.e. longest connected) persists
+const broadcastRules = (msg) => {
+  const rules = [...ruleList.values()];
+  let save = true;
+  eachClient((c) => {
+    send(c, { ...msg, rules, save });
+    save = false;
+  });
+};
+const openBar = (s) => ({ open: prices[s], high: prices[s], low: prices[s], close: prices[s] });
+
+function sendGateway(op, symbols) {
+  if (!ws || ws.readyState !== 1) return;
+  if (op === "metrics") ws.send(JSON.stringify({ op, on: metricsOn }));
+  else if (symbols.length) ws.send(JSON.stringify({ op, symbols }));
+}
+
+// metrics and tracing run while any tab wants them
+function refreshFlags() {
+  let m = false;
+  let l = false;
+  eachClient((c) => {
+    m = m || c.metrics;
+    l = l || c.latency;
+  });
+  if (m !== metricsOn) {
+    metricsOn = m;
+    ticks = 0;
+    latency.reset();
+    sendGateway("metrics");
+  }
+  if (l !== traceOn) {
+    traceOn = l;
+    originAt = {};
+    recvAt = {};
+    WORKER_STAGES.forEach((s) => stages[s].reset());
+  }
+}
+
+function subscribe(c, symbols, seed = {}) {
+  const added = [];
+  const out = [];
+  symbols.forEach((s) => {
+    if (c.symbols.has(s)) return;
+    c.symbols.add(s);
+    const n = refs.get(s) || 0;
+    refs.set(s, n + 1);
+    if (n) return;
+    if (gatewayUrl) {
+      if (seed[s] > 0) prices[s] = seed[s];
+    } else {
+      prices[s] = seed[s] > 0 ? seed[s] : 100 + Math.random() * 50;
+      bars[s] = openBar(s);
+      book.tick(s, prices[s], out);
+    }
+    added.push(s);
+  });
+  collect(out);
+  sendGateway("sub", added);
+}
+
+function dropClient(c) {
+  const tabs = clients.get(c.port);
+  if (!tabs || tabs.get(c.tab) !== c) return;
+  tabs.delete(c.tab);
+  if (!tabs.size) clients.delete(c.port);
+  const dropped = [];
+  c.symbols.forEach((s) => {
+    const n = refs.get(s) - 1;
+    if (n) {
+      refs.set(s, n);
+      return;
+    }
+    refs.delete(s);
+    delete prices[s];
+    delete bars[s];
+    delete originAt[s];
+    delete recvAt[s];
+    dropped.push(s);
+  });
+  sendGateway("unsub", dropped);
+  refreshFlags();
+}
+
+function reap() {
+  const now = Date.now();
+  const gone = [];
+  eachClient((c) => now - c.seen > REAP_MS && gone.push(c));
+  gone.forEach(dropClient);
+}
+
+// ---------- alerts
+function flush() {
+  flushTimer = 0;
+  if (!firedTotal) return;
+  const msg = { type: "alerts", fired: fired.slice(-MAX_BATCH), total: firedTotal, book: book.stats() };
+  if (rulesChanged) broadcastRules(msg);
+  else broadcast(msg);
+  rulesChanged = false;
+  fired = [];
+  firedTotal = 0;
+}
+
+function collect(out) {
+  if (!out.length) return;
+  out.forEach((f) => {
+    if (f.kind === "above" || f.kind === "below") {
+      byKey.delete(f.key);
+      if (ruleList.delete(f.key)) rulesChanged = true;
+    }
+  });
+  fired.push(...out);
+  if (fired.length > MAX_BATCH * 2) fired = fired.slice(-MAX_BATCH);
+  firedTotal += out.length;
+  if (!flushTimer) flushTimer = setTimeout(flush, DEBOUNCE_MS);
+}
+
+// true if the rule list changed
+function addAlert(c, alert) {
+  if (byKey.has(alert.key)) return false;
+  if (alert.kind === "expr") {
+    try {
+      byKey.set(alert.key, { set: rules, id: rules.add(alert) });
+    } catch (e) {
+      send(c, { type: "alert:error", key: alert.key, message: e.message });
+      return false;
+    }
+    ruleList.set(alert.key, alert);
+    return true;
+  }
+  const out = [];
+  byKey.set(alert.key, { set: book, id: book.add(alert, out) });
+  ruleList.set(alert.key, alert);
+  collect(out); // may fire (and unlist) a one-shot at once
+  return true;
+}
+
+// synthetic load for profiling: levels within ±5% of the opening price
+function seedDemo(n, symbols) {
+  const priced = symbols.filter((s) => prices[s] > 0);
+  for (let i = 0; i < n && priced.length; i++) {
+    const sym = priced[i % priced.length];
+    const level = prices[sym] * (0.95 + Math.random() * 0.1);
+    book.add({ sym, kind: ["above", "below", "cross"][i % 3], level, key: `demo-${i}` });
+  }
+}
+
+// ---------- prices
+function tick(s, p, out, ts) {
+  ticks++;
+  const bar = bars[s];
+  if (!bar) {
+    bars[s] = { open: p, high: p, low: p, close: p }; // first gateway tick
+  } else {
+    if (p > bar.high) bar.high = p;
+    if (p < bar.low) bar.low = p;
+    bar.close = p;
+  }
+  book.tick(s, p, out, ts);
+}
+
+function setWsState(state) {
+  wsState = state;
+  broadcast({ type: "ws", state });
+}
+
+// ticks from server/gateway: { t: "tick", s, p, ts, us } and, on request, { t: "m", ... }; reconnects with backoff
+function connectGateway(attempt = 0) {
+  const symbols = [...refs.keys()];
+  ws = new WebSocket(`${gatewayUrl}${gatewayUrl.includes("?") ? "&" : "?"}symbols=${symbols.join(",")}`);
+  const out = [];
+  setWsState("connecting");
+  ws.onopen = () => {
+    attempt = 0;
+    setWsState("open");
+    // tabs may have come or gone while connecting
+    sendGateway("sub", [...refs.keys()].filter((s) => !symbols.includes(s)));
+    sendGateway("unsub", symbols.filter((s) => !refs.has(s)));
+    if (metricsOn) sendGateway("metrics");
+  };
+  ws.onmessage = ({ data }) => {
+    const t0 = traceOn ? performance.now() : 0;
+    const recv = traceOn || metricsOn ? epochUs() : 0;
+    const msg = JSON.parse(data);
+    if (msg.t === "m") {
+      eachClient((c) => c.metrics && send(c, { type: "metrics", m: msg }));
+      return;
+    }
+    if (msg.t !== "tick" || !refs.has(msg.s)) return;
+    if (metricsOn) latency.record(recv - msg.us);
+    prices[msg.s] = msg.p;
+    out.length = 0;
+    tick(msg.s, msg.p, out, msg.ts);
+    collect(out);
+    if (traceOn) {
+      stages.network.record(recv - msg.us);
+      stages.decode.record((performance.now() - t0) * 1000);
+      originAt[msg.s] = msg.us;
+      recvAt[msg.s] = recv;
+    }
+  };
+  ws.onclose = () => {
+    setWsState("closed");
+    setTimeout(() => connectGateway(attempt + 1), RECONNECT_MS[Math.min(attempt, RECONNECT_MS.length - 1)]);
+  };
+}
+
+const pricesOf = (c) => {
+  const mine = {};
+  c.symbols.forEach((s) => s in prices && (mine[s] = prices[s]));
+  return mine;
+};
+
+// stats and stage histograms are computed once and go to every tab that asked for them
+let sent = {};
+function push() {
+  const ts = Date.now();
+  const changed = metricsOn || traceOn ? new Set([...refs.keys()].filter((s) => prices[s] !== sent[s])) : null;
+  let stats;
+  let pushed = 0;
+  let dumps = null;
+  if (metricsOn) {
+    stats = { ticks, conflated: Math.max(0, ticks - changed.size), lat: latency.summary() };
+    latency.reset();
+  }
+  if (traceOn) {
+    pushed = epochUs();
+    changed.forEach((s) => recvAt[s] && stages.conflation.record(pushed - recvAt[s]));
+    dumps = {};
+    WORKER_STAGES.forEach((s) => {
+      dumps[s] = stages[s].dump();
+      stages[s].reset();
+    });
+  }
+  ticks = 0;
+  sent = { ...prices };
+  eachClient((c) => {
+    let trace;
+    if (c.latency && dumps) {
+      const origins = [];
+      c.symbols.forEach((s) => changed.has(s) && originAt[s] && origins.push(originAt[s]));
+      trace = { pushed, origins, stages: dumps };
+    }
+    send(c, { type: "prices", prices: pricesOf(c), ts, stats: c.metrics ? stats : undefined, trace });
+  });
+  const out = [];
+  refs.forEach((_, s) => {
+    if (!bars[s]) return; // no tick yet
+    rules.onBar(s, bars[s], out, ts);
+    bars[s] = openBar(s);
+  });
+  collect(out);
+}
+
+// the first tab's init starts the stream; later tabs only join it
+function start({ symbols, demoAlerts = 0 }) {
+  started = true;
+  if (demoAlerts) seedDemo(demoAlerts, symbols);
+  if (gatewayUrl) {
+    connectGateway();
+  } else {
+    const out = [];
+    setInterval(() => {
+      const ts = Date.now();
+      out.length = 0;
+      refs.forEach((_, s) => tick(s, (prices[s] = Math.max(1, prices[s] + (Math.random() - 0.5) * STEP)), out, ts));
+      collect(out);
+      if (traceOn) {
+        // the walk has no network leg: a tick originates here
+        const at = epochUs();
+        refs.forEach((_, s) => (originAt[s] = recvAt[s] = at));
+      }
+    }, TICK_MS);
+  }
+  setInterval(push, PUSH_MS);
+  setInterval(reap, REAP_MS / 3);
+}
+
+function onMessage(port, data) {
+  const tab = data.tab || "";
+  const tabs = clients.get(port);
+  let c = tabs && tabs.get(tab);
+  if (data.type === "init") {
+    if (c) dropClient(c); // the tab re-sent its state (a new feedHub leader)
+    c = { port, tab, symbols: new Set(), metrics: !!data.metrics, latency: !!data.latency, seen: Date.now() };
+    if (!clients.has(port)) clients.set(port, new Map());
+    clients.get(port).set(tab, c);
+    if (!started) gatewayUrl = data.gateway || ""; // subscribe() seeds prices by it
+    subscribe(c, data.symbols, data.seed);
+    let added = false;
+    (data.alerts || []).forEach((a) => (added = addAlert(c, a) || added));
+    // every tab sees what a new tab brought; the new tab gets the list even if it brought nothing new
+    if (added) broadcastRules({ type: "rules" });
+    else send(c, { type: "rules", rules: [...ruleList.values()] });
+    refreshFlags();
+    if (!started) start(data);
+    send(c, { type: "prices", prices: pricesOf(c), ts: Date.now() });
+    if (gatewayUrl) send(c, { type: "ws", state: wsState });
+    return;
+  }
+  if (!c) {
+    if (data.type !== "bye") port.postMessage({ type: "reinit", tab }); // reaped while its timers were throttled
+    return;
+  }
+  c.seen = Date.now();
+  if (data.type === "alert:add") {
+    if (addAlert(c, data.alert)) broadcastRules({ type: "rules" });
+  } else if (data.type === "alert:remove") {
+    const entry = byKey.get(data.key);
+    if (entry) entry.set.remove(entry.id);
+    byKey.delete(data.key);
+    if (ruleList.delete(data.key)) broadcastRules({ type: "rules" });
+  } else if (data.type === "metrics") {
+    c.metrics = data.on;
+    refreshFlags();
+  } else if (data.type === "latency") {
+    c.latency = data.on;
+    refreshFlags();
+  } else if (data.type === "bye") {
+    dropClient(c);
+  }
+}
+
+if ("onconnect" in self) {
+  // SharedWorker: one port per tab
+  self.onconnect = ({ ports: [port] }) => {
+    port.onmessage = ({ data }) => onMessage(port, data);
+  };
+} else {
+  self.onmessage = ({ data }) => onMessage(self, data);
+}
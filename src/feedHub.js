@@ -0,0 +1,159 @@
+import { canSpawnWorkers, spawnFeedWorker, spawnSharedFeedWorker } from "./workers";
+
+/**
+ * One feed.worker.js for every open tab, so N tabs hold one market-data connection and not N
+ * - SharedWorker where the browser has one: each tab gets its own port into the same worker
+ * - Otherwise BroadcastChannel leader election: the leader tab runs a dedicated feed worker and
+ *   relays the other tabs' messages to it (and its replies back) over the "fs:feed" channel;
+ *   when the leader closes or stops heartbeating, the oldest remaining tab takes over and every
+ *   tab re-sends its init to the new worker
+ * - Otherwise a dedicated worker per tab; null without workers (the caller walks prices itself)
+ * Every message carries this tab's id; the worker ref-counts the tabs' symbols and drops a tab on
+ * "bye" or after missed pings (then answers "reinit" should it come back, e.g. from the bfcache).
+ */
+
+export const PING_MS = 5000;
+const CHANNEL = "fs:feed";
+
+// base-36 start time first, so string order is age order and the oldest tab wins an election
+const newTabId = () => `${Date.now().toString(36).padStart(9, "0")}-${Math.random().toString(36).slice(2, 8)}`;
+const openChannel = (name) => (typeof BroadcastChannel === "function" ? new BroadcastChannel(name) : null);
+
+// hello(): the tab's current init message, sent on connect and again whenever the worker changes
+export function connectFeed({
+  hello,
+  onMessage,
+  tab = newTabId(),
+  heartbeatMs = 1000,
+  pingMs = PING_MS,
+  spawnShared = spawnSharedFeedWorker,
+  spawnWorker = spawnFeedWorker,
+  channel = openChannel,
+  canSpawn = canSpawnWorkers,
+}) {
+  let up; // posts one message towards the worker
+  let mode;
+  let end = () => {};
+  const tagged = (msg) => ({ ...msg, tab });
+  const deliver = (data) => {
+    if (data.tab !== tab) return;
+    if (data.type === "reinit") up(hello());
+    else onMessage(data);
+  };
+
+  const shared = spawnShared();
+  const bc = shared || !canSpawn() ? null : channel(CHANNEL);
+  if (shared) {
+    mode = "shared";
+    shared.port.onmessage = ({ data }) => deliver(data);
+    up = (msg) => shared.port.postMessage(tagged(msg));
+    up(hello());
+  } else if (bc) {
+    mode = "follower";
+    end = elect();
+  } else {
+    const worker = canSpawn() ? spawnWorker() : null;
+    if (!worker) return null;
+    mode = "worker";
+    worker.onmessage = ({ data }) => deliver(data);
+    up = (msg) => worker.postMessage(tagged(msg));
+    up(hello());
+    end = () => worker.terminate();
+  }
+
+  // ---------- leader election
+  function elect() {
+    const settleMs = heartbeatMs / 5;
+    let worker = null; // set while this tab leads
+    let leader = null;
+    let seen = 0;
+    let claiming = false;
+    let timer = 0;
+
+    up = (msg) => {
+      if (worker) worker.postMessage(tagged(msg));
+      else if (leader) bc.postMessage({ kind: "up", msg: tagged(msg) });
+      // no leader yet: hello() goes out once there is one
+    };
+    const heartbeat = () => bc.postMessage({ kind: "hb", id: tab });
+    const lead = () => {
+      mode = "leader";
+      leader = tab;
+      worker = spawnWorker();
+      worker.onmessage = ({ data }) => (data.tab === tab ? deliver(data) : bc.postMessage({ kind: "feed", msg: data }));
+      heartbeat();
+      up(hello());
+    };
+    const follow = (id) => {
+      if (worker) {
+        worker.terminate();
+        worker = null;
+      }
+      mode = "follower";
+      seen = Date.now();
+      if (leader === id) return;
+      leader = id;
+      up(hello());
+    };
+    const claim = () => {
+      claiming = true;
+      bc.postMessage({ kind: "claim", id: tab });
+      setTimeout(() => {
+        if (claiming && !worker && Date.now() - seen > heartbeatMs) lead();
+        claiming = false;
+      }, settleMs);
+    };
+
+    bc.onmessage = ({ data }) => {
+      if (data.id === tab) return;
+      if (data.kind === "hb") {
+        // two leaders after a partition: the younger one steps down
+        if (!worker || data.id < tab) follow(data.id);
+      } else if (data.kind === "claim") {
+        if (worker) heartbeat();
+        else if (data.id < tab) claiming = false;
+      } else if (data.kind === "who") {
+        if (worker) heartbeat();
+      } else if (data.kind === "resign") {
+        if (data.id === leader && !worker) {
+          leader = null;
+          seen = 0;
+          claim();
+        }
+      } else if (data.kind === "up") {
+        if (worker) worker.postMessage(data.msg);
+      } else if (data.kind === "feed") {
+        if (!worker) deliver(data.msg);
+      }
+    };
+    timer = setInterval(() => {
+      if (worker) heartbeat();
+      else if (!claiming && Date.now() - seen > heartbeatMs * 3) claim();
+    }, heartbeatMs);
+    bc.postMessage({ kind: "who" });
+    setTimeout(() => leader || claiming || claim(), settleMs);
+
+    return () => {
+      clearInterval(timer);
+      if (worker) {
+        bc.postMessage({ kind: "resign", id: tab });
+        worker.terminate();
+        worker = null;
+      }
+      bc.close();
+    };
+  }
+
+  const ping = setInterval(() => up({ type: "ping" }), pingMs);
+  return {
+    tab,
+    mode: () => mode,
+    postMessage: (msg) => up(msg),
+    // pagehide: the worker drops this tab's symbols now instead of after missed pings
+    close() {
+      up({ type: "bye" });
+      clearInterval(ping);
+      end();
+    },
+  };
+}
@@ -0,0 +1,80 @@
+import { connectFeed } from './feedHub';
+
+const sleep = (ms) => new Promise((r) => setTimeout(r, ms));
+
+// BroadcastChannel stand-in: async delivery to every other channel of the same name
+function bus() {
+  const channels = new Set();
+  return (name) => {
+    const ch = {
+      name,
+      onmessage: null,
+      postMessage: (data) => channels.forEach((o) => o !== ch && o.name === name && setTimeout(() => o.onmessage && o.onmessage({ data }))),
+      close: () => channels.delete(ch),
+    };
+    channels.add(ch);
+    return ch;
+  };
+}
+
+const fakeWorker = (log) => {
+  const w = { got: [], onmessage: null, terminated: false };
+  w.postMessage = (msg) => w.got.push(msg);
+  w.emit = (data) => w.onmessage({ data });
+  w.terminate = () => (w.terminated = true);
+  log.push(w);
+  return w;
+};
+
+test('a shared worker port carries the tab id both ways and reinit resends hello', () => {
+  const port = { got: [], onmessage: null, postMessage: (m) => port.got.push(m) };
+  const seen = [];
+  const hub = connectFeed({ tab: 't1', hello: () => ({ type: 'init', symbols: ['A'] }), onMessage: (d) => seen.push(d.type), spawnShared: () => ({ port }), pingMs: 1e9 });
+  expect(hub.mode()).toBe('shared');
+  expect(port.got).toEqual([{ type: 'init', symbols: ['A'], tab: 't1' }]);
+  port.onmessage({ data: { tab: 't2', type: 'prices' } });
+  port.onmessage({ data: { tab: 't1', type: 'prices' } });
+  port.onmessage({ data: { tab: 't1', type: 'reinit' } });
+  expect(seen).toEqual(['prices']);
+  expect(port.got.length).toBe(2);
+  hub.close();
+  expect(port.got[2]).toEqual({ type: 'bye', tab: 't1' });
+});
+
+test('without SharedWorker the oldest tab leads, relays the others and hands over on close', async () => {
+  const channel = bus();
+  const workers = [];
+  const opts = (tab, seen) => ({
+    tab,
+    hello: () => ({ type: 'init', symbols: [tab] }),
+    onMessage: (d) => seen.push(d.prices),
+    heartbeatMs: 50,
+    pingMs: 1e9,
+    spawnShared: () => null,
+    spawnWorker: () => fakeWorker(workers),
+    channel,
+    canSpawn: () => true,
+  });
+  const seenA = [];
+  const seenB = [];
+  const a = connectFeed(opts('a', seenA));
+  const b = connectFeed(opts('b', seenB));
+  await sleep(120);
+  expect([a.mode(), b.mode()]).toEqual(['leader', 'follower']);
+  expect(workers.length).toBe(1);
+  // both inits reach the one worker, and replies find their tab
+  expect(workers[0].got.map((m) => m.tab).sort()).toEqual(['a', 'b']);
+  workers[0].emit({ tab: 'b', type: 'prices', prices: { b: 1 } });
+  workers[0].emit({ tab: 'a', type: 'prices', prices: { a: 2 } });
+  await sleep(10);
+  expect(seenA).toEqual([{ a: 2 }]);
+  expect(seenB).toEqual([{ b: 1 }]);
+
+  a.close();
+  expect(workers[0].terminated).toBe(true);
+  await sleep(120);
+  expect(b.mode()).toBe('leader');
+  expect(workers.length).toBe(2);
+  expect(workers[1].got[0]).toEqual({ type: 'init', symbols: ['b'], tab: 'b' });
+  b.close();
+});
@@ -0,0 +1,232 @@
+import { useCallback, useRef, useSyncExternalStore } from "react";
+
+/**
+ * Shared request cache for snapshot / history / reference loads
+ * - One entry per key; concurrent requests for a key share one in-flight promise
+ * - Fresh for `ttl` ms, then served stale for up to `swr` ms more while a single background
+ *   revalidation runs; anything older is a miss
+ * - A failed first load is remembered for `retry` ms: reads throw its error (to the nearest error
+ *   boundary) instead of refetching on every Suspense retry; invalidate() clears it sooner
+ * - LRU bounded by retained bytes (typed arrays exact, everything else estimated once on insert)
+ * - useCached() reads through Suspense; stats() feeds the System Health card
+ */
+
+const DEFAULTS = { ttl: 30000, swr: 5 * 60000, retry: 10000 };
+
+// rough retained size; exact for the typed arrays that dominate history payloads
+export function sizeOf(v, depth = 0) {
+  if (v == null) return 0;
+  if (typeof v === "string") return 2 * v.length;
+  if (typeof v !== "object") return 8;
+  if (ArrayBuffer.isView(v) || v instanceof ArrayBuffer) return v.byteLength;
+  if (depth > 8) return 64;
+  let n = 16;
+  if (Array.isArray(v)) v.forEach((x) => (n += 8 + sizeOf(x, depth + 1)));
+  else Object.keys(v).forEach((k) => (n += 2 * k.length + 8 + sizeOf(v[k], depth + 1)));
+  return n;
+}
+
+export function createFetchCache({ maxBytes = 16 << 20, now = () => Date.now() } = {}) {
+  const entries = new Map(); // key -> entry, in LRU order (oldest first)
+  const listeners = new Map(); // key -> Set<fn>
+  const statListeners = new Set();
+  const counts = { hits: 0, misses: 0, stale: 0, deduped: 0, revalidations: 0, evictions: 0, errors: 0 };
+  let bytes = 0;
+  let statsTimer = 0;
+
+  // stats change during render (reads are counted there), so listeners hear about it a tick later
+  const statsChanged = () => {
+    if (!statsTimer && statListeners.size) {
+      statsTimer = setTimeout(() => {
+        statsTimer = 0;
+        statListeners.forEach((l) => l());
+      }, 0);
+    }
+  };
+  const notify = (key) => (listeners.get(key) || []).forEach((l) => l());
+
+  const touch = (e) => {
+    entries.delete(e.key);
+    entries.set(e.key, e);
+  };
+
+  function evict() {
+    for (const e of entries.values()) {
+      if (bytes <= maxBytes) break;
+      if (e.promise || !e.hasValue) continue; // never drop what someone is waiting on
+      entries.delete(e.key);
+      bytes -= e.bytes;
+      counts.evictions++;
+      notify(e.key);
+    }
+  }
+
+  function load(e, loader) {
+    e.promise = Promise.resolve()
+      .then(() => loader(e.key))
+      .then(
+        (value) => {
+          const size = sizeOf(value);
+          const current = entries.get(e.key) === e; // not invalidated or evicted meanwhile
+          if (current) bytes += size - (e.hasValue ? e.bytes : 0);
+          e.bytes = size;
+          e.value = value;
+          e.hasValue = true;
+          e.error = null;
+          e.at = now();
+          e.primed = false;
+          e.version++;
+          e.promise = null;
+          if (current) touch(e);
+          evict();
+          notify(e.key);
+          statsChanged();
+          return value;
+        },
+        (error) => {
+          e.promise = null;
+          counts.errors++;
+          // a failed revalidation keeps serving the stale value; a failed first load is served as
+          // its error until the retry window ends
+          if (!e.hasValue) e.at = now();
+          e.error = error;
+          notify(e.key);
+          statsChanged();
+          throw error;
+        }
+      );
+    return e.promise;
+  }
+
+  /**
+   * Looks `key` up and starts whatever fetch is needed.
+   * Returns { value, hasValue, promise }: promise is set while a fetch for this key is in flight.
+   * count = false skips the hit/miss accounting (re-renders of the same reader); suspends = true
+   * when the caller will come back for the value after a miss (Suspense retry), so that read is
+   * not counted a second time as a hit.
+   */
+  function lookup(key, loader, opts, count, suspends) {
+    const { ttl, swr, retry } = { ...DEFAULTS, ...opts };
+    let e = entries.get(key);
+    const age = e && e.hasValue ? now() - e.at : Infinity;
+    // a primed value is served whatever its age, and counts as stale so the first read revalidates
+    if (e && e.hasValue && (age <= ttl + swr || e.primed)) {
+      touch(e);
+      if (count) {
+        // the first reader after a miss is the one that waited for it
+        if (e.claimPending) e.claimPending = false;
+        else counts.hits++;
+      }
+      if ((age > ttl || e.primed) && !e.promise) {
+        if (count) counts.stale++;
+        counts.revalidations++;
+        load(e, loader).catch(() => {});
+      }
+      statsChanged();
+      return e;
+    }
+    if (e && e.promise) {
+      if (count) counts.deduped++;
+      statsChanged();
+      return e;
+    }
+    if (e && !e.hasValue && e.error && now() - e.at < retry) return e;
+    if (!e) {
+      e = { key, value: undefined, hasValue: false, bytes: 0, at: 0, version: 0, promise: null, error: null, claimPending: false, primed: false };
+      entries.set(key, e);
+    } else if (e.hasValue) {
+      bytes -= e.bytes; // too old to serve
+      e.hasValue = false;
+      e.value = undefined;
+    }
+    if (count) counts.misses++;
+    e.claimPending = count && suspends;
+    load(e, loader).catch(() => {});
+    statsChanged();
+    return e;
+  }
+
+  return {
+    /** Promise API: resolves from cache when fresh or stale-but-usable, otherwise after the (shared) fetch. */
+    get(key, loader, opts) {
+      const e = lookup(key, loader, opts, true, false);
+      if (e.hasValue) return Promise.resolve(e.value);
+      return e.promise || Promise.reject(e.error);
+    },
+    /** Suspense API: returns the value or throws the in-flight promise (or the load error). */
+    read(key, loader, opts, count = true) {
+      const e = lookup(key, loader, opts, count, true);
+      if (e.hasValue) return e.value;
+      if (e.promise) throw e.promise;
+      throw e.error;
+    },
+    /** Seeds `key` with a value from elsewhere (a persisted snapshot) unless it already has one. */
+    prime(key, value) {
+      if (entries.has(key)) return;
+      const size = sizeOf(value);
+      entries.set(key, { key, value, hasValue: true, bytes: size, at: now(), version: 1, promise: null, error: null, claimPending: false, primed: true });
+      bytes += size;
+      evict();
+      notify(key);
+    },
+    peek: (key) => {
+      const e = entries.get(key);
+      return e && e.hasValue ? e.value : undefined;
+    },
+    version: (key) => {
+      const e = entries.get(key);
+      return e ? e.version : -1;
+    },
+    /** Drops every entry whose key equals `key` or starts with `key` when it ends in ":" */
+    invalidate(key) {
+      Array.from(entries.keys()).forEach((k) => {
+        if (k === key || (key.endsWith(":") && k.startsWith(key))) {
+          bytes -= entries.get(k).hasValue ? entries.get(k).bytes : 0;
+          entries.delete(k);
+          notify(k);
+        }
+      });
+      statsChanged();
+    },
+    subscribe(key, listener) {
+      if (!listeners.has(key)) listeners.set(key, new Set());
+      listeners.get(key).add(listener);
+      return () => listeners.get(key).delete(listener);
+    },
+    subscribeStats(listener) {
+      statListeners.add(listener);
+      return () => statListeners.delete(listener);
+    },
+    stats() {
+      const lookups = counts.hits + counts.misses + counts.deduped;
+      return { ...counts, entries: entries.size, bytes, maxBytes, hitRatio: lookups ? (counts.hits + counts.deduped) / lookups : null };
+    },
+  };
+}
+
+export const fetchCache = createFetchCache();
+
+// ---------- hooks
+// Suspends until `key` has a value; re-renders when a background revalidation lands.
+export function useCached(key, loader, opts, cache = fetchCache) {
+  const seen = useRef(null);
+  const subscribe = useCallback((cb) => cache.subscribe(key, cb), [cache, key]);
+  useSyncExternalStore(subscribe, () => cache.version(key));
+  const value = cache.read(key, loader, opts, seen.current !== key);
+  seen.current = key;
+  return value;
+}
+
+// stats snapshot, refreshed at most once per tick of cache activity
+export function useCacheStats(cache = fetchCache) {
+  const snap = useRef(null);
+  const subscribe = useCallback(
+    (cb) =>
+      cache.subscribeStats(() => {
+        snap.current = null;
+        cb();
+      }),
+    [cache]
+  );
+  return useSyncExternalStore(subscribe, () => snap.current || (snap.current = cache.stats()));
+}
@@ -0,0 +1,96 @@
+import { createFetchCache } from './fetchCache';
+
+const deferred = () => {
+  let resolve;
+  const promise = new Promise((r) => (resolve = r));
+  return { promise, resolve };
+};
+
+test('concurrent requests share one fetch', async () => {
+  const cache = createFetchCache();
+  const d = deferred();
+  let calls = 0;
+  const loader = () => {
+    calls++;
+    return d.promise;
+  };
+  const both = Promise.all([cache.get('a', loader), cache.get('a', loader)]);
+  d.resolve(42);
+  expect(await both).toEqual([42, 42]);
+  expect(calls).toBe(1);
+  expect(cache.stats()).toMatchObject({ misses: 1, deduped: 1, hits: 0 });
+});
+
+test('stale entries are served while one revalidation runs', async () => {
+  let t = 0;
+  const cache = createFetchCache({ now: () => t });
+  let version = 0;
+  const loader = () => Promise.resolve(++version);
+  expect(await cache.get('k', loader, { ttl: 10, swr: 100 })).toBe(1);
+  t = 50;
+  expect(await cache.get('k', loader, { ttl: 10, swr: 100 })).toBe(1); // stale, revalidating
+  expect(await cache.get('k', loader, { ttl: 10, swr: 100 })).toBe(1); // still in flight: no second fetch
+  await new Promise((r) => setTimeout(r, 0));
+  expect(cache.peek('k')).toBe(2);
+  t = 500;
+  expect(await cache.get('k', loader, { ttl: 10, swr: 100 })).toBe(3); // too old: a plain miss
+  expect(cache.stats()).toMatchObject({ hits: 2, misses: 2, stale: 1, revalidations: 1 });
+});
+
+test('least recently used entries are evicted past the byte budget', async () => {
+  const cache = createFetchCache({ maxBytes: 2500 });
+  const load = () => Promise.resolve(new Float64Array(128)); // 1 KB each
+  await cache.get('a', load);
+  await cache.get('b', load);
+  await cache.get('a', load); // a is now the most recent
+  await cache.get('c', load);
+  expect(cache.peek('a')).toBeDefined();
+  expect(cache.peek('b')).toBeUndefined();
+  expect(cache.stats()).toMatchObject({ entries: 2, bytes: 2048, evictions: 1 });
+});
+
+test('a primed value is served at once and revalidated by its first read', async () => {
+  const cache = createFetchCache();
+  const d = deferred();
+  let calls = 0;
+  const loader = () => {
+    calls++;
+    return d.promise;
+  };
+  cache.prime('k', 'snapshot');
+  expect(await cache.get('k', loader, { ttl: 60000 })).toBe('snapshot');
+  expect(calls).toBe(1);
+  d.resolve('live');
+  await new Promise((r) => setTimeout(r));
+  expect(cache.peek('k')).toBe('live');
+  cache.prime('k', 'older');
+  expect(cache.peek('k')).toBe('live');
+});
+
+test('a failed first load throws its error until the retry window ends or the key is invalidated', async () => {
+  let t = 0;
+  const cache = createFetchCache({ now: () => t });
+  let calls = 0;
+  const loader = () => {
+    calls++;
+    return Promise.reject(new Error('down'));
+  };
+  let thrown;
+  try {
+    cache.read('k', loader, { retry: 1000 });
+  } catch (p) {
+    thrown = p;
+  }
+  await thrown.catch(() => {});
+  // the Suspense retry reaches the error boundary instead of starting another fetch
+  expect(() => cache.read('k', loader, { retry: 1000 })).toThrow('down');
+  await expect(cache.get('k', loader, { retry: 1000 })).rejects.toThrow('down');
+  expect(calls).toBe(1);
+  t = 1000;
+  await expect(cache.get('k', loader, { retry: 1000 })).rejects.toThrow('down');
+  expect(calls).toBe(2);
+  cache.invalidate('k');
+  await expect(cache.get('k', loader, { retry: 1000 })).rejects.toThrow('down');
+  expect(calls).toBe(3);
+  expect(cache.stats().errors).toBe(3);
+});
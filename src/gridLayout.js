@@ -0,0 +1,67 @@
+/**
+ * Dashboard grid layout engine (pure – also runs inside gridLayout.worker.js)
+ * - Items are { id, x, y, w, h } on a COLS-wide grid; y/h count card rows (auto height)
+ * - moveItem() places one item and pushes whatever it lands on downwards
+ * - compact() floats every item up to the first free row (vertical gravity)
+ */
+
+export const COLS = 12;
+export const MIN_W = 3;
+
+const collides = (a, b) => a.id !== b.id && a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+
+const byPosition = (a, b) => a.y - b.y || a.x - b.x;
+
+export const clampItem = (it) => {
+  const w = Math.max(MIN_W, Math.min(COLS, it.w));
+  return { ...it, w, x: Math.max(0, Math.min(COLS - w, it.x)), y: Math.max(0, it.y), h: it.h || 1 };
+};
+
+export function compact(layout) {
+  const placed = [];
+  layout
+    .slice()
+    .sort(byPosition)
+    .forEach((item) => {
+      const it = { ...item };
+      while (it.y > 0 && !placed.some((p) => collides({ ...it, y: it.y - 1 }, p))) it.y--;
+      // an item pushed onto an occupied slot by a stale layout still has to clear it
+      while (placed.some((p) => collides(it, p))) it.y++;
+      placed.push(it);
+    });
+  return placed.sort(byPosition);
+}
+
+export function moveItem(layout, id, patch) {
+  const moved = clampItem({ ...layout.find((it) => it.id === id), ...patch });
+  const out = [moved];
+  // everything the moved item (or a pushed item) overlaps goes below it, top to bottom
+  layout
+    .filter((it) => it.id !== id)
+    .sort(byPosition)
+    .forEach((item) => {
+      const it = { ...item };
+      let hit = out.find((p) => collides(it, p));
+      while (hit) {
+        it.y = hit.y + hit.h;
+        hit = out.find((p) => collides(it, p));
+      }
+      out.push(it);
+    });
+  return out.sort(byPosition);
+}
+
+// Drop ids that are no longer rendered and append new ones under the existing grid.
+export function syncLayout(layout, ids, defaults) {
+  const keep = (layout || []).filter((it) => ids.includes(it.id)).map(clampItem);
+  let bottom = keep.reduce((m, it) => Math.max(m, it.y + it.h), 0);
+  ids.forEach((id) => {
+    if (keep.some((it) => it.id === id)) return;
+    const d = defaults.find((it) => it.id === id) || { id, x: 0, w: 6 };
+    keep.push(clampItem({ ...d, y: bottom++ }));
+  });
+  return compact(keep);
+}
+
+export const sameLayout = (a, b) =>
+  a.length === b.length && a.every((it, i) => it.id === b[i].id && it.x === b[i].x && it.y === b[i].y && it.w === b[i].w && it.h === b[i].h);
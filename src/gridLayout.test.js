@@ -0,0 +1,40 @@
+import { COLS, MIN_W, compact, moveItem, sameLayout, syncLayout } from './gridLayout';
+
+const item = (id, x, y, w = 6, h = 1) => ({ id, x, y, w, h });
+const at = (layout) => Object.fromEntries(layout.map((it) => [it.id, [it.x, it.y, it.w]]));
+
+test('compact floats items up to the first free row', () => {
+  const layout = [item('a', 0, 3), item('b', 6, 5), item('c', 0, 7, 12)];
+  expect(at(compact(layout))).toEqual({ a: [0, 0, 6], b: [6, 0, 6], c: [0, 1, 12] });
+  // overlapping input is pulled apart, not stacked on one slot
+  expect(at(compact([item('a', 0, 0), item('b', 3, 0)]))).toEqual({ a: [0, 0, 6], b: [3, 1, 6] });
+});
+
+test('moveItem places the item and pushes what it lands on down', () => {
+  const layout = [item('a', 0, 0), item('b', 6, 0), item('c', 0, 1)];
+  const moved = moveItem(layout, 'c', { x: 6, y: 0 });
+  expect(at(moved)).toEqual({ c: [6, 0, 6], a: [0, 0, 6], b: [6, 1, 6] });
+  expect(at(compact(moved))).toEqual(at(moved));
+});
+
+test('moveItem clamps width and position to the grid', () => {
+  const layout = [item('a', 0, 0), item('b', 6, 0)];
+  expect(at(moveItem(layout, 'a', { w: 1 })).a).toEqual([0, 0, MIN_W]);
+  expect(at(moveItem(layout, 'b', { x: 10, w: 6 })).b).toEqual([COLS - 6, 0, 6]);
+  expect(at(moveItem(layout, 'a', { x: -4, y: -2 })).a).toEqual([0, 0, 6]);
+});
+
+test('syncLayout drops unknown ids and appends new ones from the defaults', () => {
+  const saved = [item('a', 6, 0), item('gone', 0, 0)];
+  const defaults = [item('a', 0, 0), item('b', 0, 1, 12)];
+  const layout = syncLayout(saved, ['a', 'b', 'c'], defaults);
+  expect(at(layout)).toEqual({ a: [6, 0, 6], b: [0, 1, 12], c: [0, 2, 6] });
+  expect(at(syncLayout(null, ['a'], defaults))).toEqual({ a: [0, 0, 6] });
+});
+
+test('sameLayout compares ids and placement in order', () => {
+  const a = [item('a', 0, 0), item('b', 6, 0)];
+  expect(sameLayout(a, a.map((it) => ({ ...it })))).toBe(true);
+  expect(sameLayout(a, [a[0], { ...a[1], y: 1 }])).toBe(false);
+  expect(sameLayout(a, [a[1], a[0]])).toBe(false);
+});
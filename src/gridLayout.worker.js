@@ -0,0 +1,7 @@
+/* eslint-disable no-restricted-globals */
+import { compact } from "./gridLayout";
+
+// { seq, layout } -> { seq, layout: compacted }
+self.onmessage = ({ data }) => {
+  self.postMessage({ seq: data.seq, layout: compact(data.layout) });
+};
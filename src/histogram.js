@@ -0,0 +1,89 @@
+/**
+ * Log-linear latency histogram (the same bucketing as server/gateway/src/histogram.hpp)
+ * - Values below 2^SUB_BITS are exact; above, each power of two is split into 2^SUB_BITS linear
+ *   buckets, so a percentile is reported within 1/2^SUB_BITS (~1.6%) of the true value
+ * - Fixed Uint32Array, O(1) record, mergeable; percentile() returns the bucket's upper edge
+ * - Integer values (µs here); anything past 2^32 lands in the last bucket
+ * - dump() is a sparse { n, max, b: [index, count, ...] } copy for postMessage / beacons; merge()
+ *   takes either a histogram or a dump
+ */
+
+const SUB_BITS = 6;
+const SUB = 1 << SUB_BITS;
+const ROWS = 32 - SUB_BITS + 1;
+
+const indexOf = (v) => {
+  if (v < SUB) return v;
+  if (v >= 2 ** 32) return ROWS * SUB - 1;
+  const e = 31 - Math.clz32(v) - SUB_BITS;
+  return (e + 1) * SUB + ((v >>> e) & (SUB - 1));
+};
+
+const upperOf = (i) => {
+  if (i < SUB) return i;
+  const e = Math.floor(i / SUB) - 1;
+  return ((SUB | i % SUB) * 2 ** e) + 2 ** e - 1;
+};
+
+export function createHistogram() {
+  const counts = new Uint32Array(ROWS * SUB);
+  let total = 0;
+  let max = 0;
+
+  const h = {
+    record(value) {
+      const v = value > 0 ? Math.round(value) : 0;
+      counts[indexOf(v)]++;
+      total++;
+      if (v > max) max = v;
+    },
+    /** q in [0, 1]; 0 when empty */
+    percentile(q) {
+      if (!total) return 0;
+      const rank = Math.max(1, Math.ceil(q * total)); // nearest rank
+      let seen = 0;
+      for (let i = 0; i < counts.length; i++) {
+        seen += counts[i];
+        if (seen >= rank) return Math.min(upperOf(i), max);
+      }
+      return max;
+    },
+    // [p50, p99, p999] in one pass, or null when nothing was recorded
+    summary() {
+      if (!total) return null;
+      const ranks = [0.5, 0.99, 0.999].map((q) => Math.max(1, Math.ceil(q * total)));
+      const out = [];
+      let seen = 0;
+      for (let i = 0; i < counts.length && out.length < ranks.length; i++) {
+        seen += counts[i];
+        while (out.length < ranks.length && seen >= ranks[out.length]) out.push(Math.min(upperOf(i), max));
+      }
+      return out;
+    },
+    merge(other) {
+      if (other.b) {
+        for (let k = 0; k < other.b.length; k += 2) counts[other.b[k]] += other.b[k + 1];
+        total += other.n;
+        max = Math.max(max, other.max);
+        return;
+      }
+      other.counts.forEach((n, i) => (counts[i] += n));
+      total += other.count();
+      max = Math.max(max, other.max());
+    },
+    dump() {
+      const b = [];
+      counts.forEach((n, i) => n && b.push(i, n));
+      return { n: total, max, b };
+    },
+    reset() {
+      counts.fill(0);
+      total = 0;
+      max = 0;
+    },
+    count: () => total,
+    max: () => max,
+    counts,
+  };
+  return h;
+}
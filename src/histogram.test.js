@@ -0,0 +1,29 @@
+import { createHistogram } from './histogram';
+
+test('percentiles stay within the bucket precision', () => {
+  const h = createHistogram();
+  for (let v = 1; v <= 100000; v++) h.record(v);
+  const near = (got, want) => got >= want && got <= want * (1 + 1 / 64);
+  expect(near(h.percentile(0.5), 50000)).toBe(true);
+  expect(near(h.percentile(0.99), 99000)).toBe(true);
+  expect(h.percentile(1)).toBe(100000);
+  const [p50, p99, p999] = h.summary();
+  expect([p50, p99]).toEqual([h.percentile(0.5), h.percentile(0.99)]);
+  expect(near(p999, 99900)).toBe(true);
+});
+
+test('small values are exact, and histograms merge and reset', () => {
+  const a = createHistogram();
+  const b = createHistogram();
+  [3, 3, 7].forEach((v) => a.record(v));
+  b.record(2 ** 40); // past the range: clamped into the last bucket, max kept exact
+  expect(a.summary()).toEqual([3, 7, 7]);
+  a.merge(b);
+  expect(a.count()).toBe(4);
+  expect(a.max()).toBe(2 ** 40);
+  const c = createHistogram();
+  c.merge(a.dump()); // the sparse form a worker posts
+  expect([c.count(), c.max(), c.summary()]).toEqual([4, 2 ** 40, a.summary()]);
+  a.reset();
+  expect(a.summary()).toBeNull();
+});
@@ -0,0 +1,55 @@
+/**
+ * Minimal promise wrapper around one IndexedDB database.
+ * Stores are listed in STORES; adding one only needs a DB_VERSION bump.
+ * Every helper rejects when IndexedDB is unavailable (private mode, tests) – callers treat
+ * that as a cache miss.
+ */
+
+const DB_NAME = "finsight";
+const DB_VERSION = 2;
+const STORES = ["cache", "prefs"];
+
+let dbPromise = null;
+function open() {
+  if (!dbPromise) {
+    dbPromise = new Promise((resolve, reject) => {
+      if (typeof indexedDB === "undefined") return reject(new Error("indexedDB unavailable"));
+      const req = indexedDB.open(DB_NAME, DB_VERSION);
+      req.onupgradeneeded = () => STORES.forEach((s) => req.result.objectStoreNames.contains(s) || req.result.createObjectStore(s));
+      req.onsuccess = () => resolve(req.result);
+      req.onerror = () => reject(req.error);
+    });
+    dbPromise.catch(() => (dbPromise = null));
+  }
+  return dbPromise;
+}
+
+// fn returns its request, or a function computing the result once the transaction completes
+const run = (store, mode, fn) =>
+  open().then(
+    (db) =>
+      new Promise((resolve, reject) => {
+        const tx = db.transaction(store, mode);
+        const req = fn(tx.objectStore(store));
+        tx.oncomplete = () => resolve(typeof req === "function" ? req() : req.result);
+        tx.onerror = tx.onabort = () => reject(tx.error);
+      })
+  );
+
+export const idbGet = (store, key) => run(store, "readonly", (s) => s.get(key));
+export const idbPut = (store, key, value) => run(store, "readwrite", (s) => s.put(value, key));
+export const idbDelete = (store, key) => run(store, "readwrite", (s) => s.delete(key));
+
+// every [key, value] pair of a store, read in one transaction
+export const idbEntries = (store) =>
+  run(store, "readonly", (s) => {
+    const keys = s.getAllKeys();
+    const values = s.getAll();
+    return () => keys.result.map((k, i) => [k, values.result[i]]);
+  });
+// several puts (and deletes, for an undefined value) committed together
+export const idbPutMany = (store, entries) =>
+  run(store, "readwrite", (s) => {
+    entries.forEach(([k, v]) => (v === undefined ? s.delete(k) : s.put(v, k)));
+    return () => entries.length;
+  });
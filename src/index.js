@@ -2,10 +2,21 @@ import React from 'react';
 import ReactDOM from 'react-dom/client';
 import './index.css';
 import App from './App';
+import reportWebVitals from './reportWebVitals';
+import { vitals } from './vitals';
+import { prefs } from './prefs';
+import { warmStart } from './warmStart';
 
+// theme, role, layouts and the last-known dashboard state are in memory before the first render,
+// so nothing flips after paint and a reload shows populated charts in its first frame
 const root = ReactDOM.createRoot(document.getElementById('root'));
-root.render(
-  <React.StrictMode>
-    <App />
-  </React.StrictMode>
+Promise.all([prefs.load(), warmStart.load()]).then(() =>
+  root.render(
+    <React.StrictMode>
+      <App />
+    </React.StrictMode>
+  )
 );
+
+// only with REACT_APP_VITALS_BEACON set (see vitals.js)
+if (vitals) reportWebVitals(vitals.report);
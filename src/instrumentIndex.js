@@ -0,0 +1,201 @@
+/**
+ * Instrument search index (pure; built and queried inside instrumentSearch.worker.js)
+ * - Tickers: packed prefix trie over the symbol-sorted id order. Every node covers a contiguous
+ *   range of that order; nodes with more than TOP_K ids carry a precomputed top-K by rank
+ * - Names: trigram posting lists (CSR) over normalized names, scored by matched-gram ratio
+ * - Rank: log liquidity minus a recency penalty for instruments that stopped trading
+ * All fields are typed arrays so the whole index structured-clones into IndexedDB.
+ */
+
+export const TOP_K = 8;
+const ALPHABET = 37; // 0 = space/other, 1-26 = a-z, 27-36 = 0-9
+const GRAMS = ALPHABET * ALPHABET * ALPHABET;
+
+const charCode = (c) => {
+  if (c >= 97 && c <= 122) return c - 96;
+  if (c >= 65 && c <= 90) return c - 64;
+  if (c >= 48 && c <= 57) return c - 21;
+  return 0;
+};
+const normalize = (s) => ` ${s.toLowerCase().replace(/[^a-z0-9]+/g, " ").trim()}`;
+
+// trigram ids of a normalized string, deduplicated
+function gramsOf(s, out = []) {
+  out.length = 0;
+  for (let i = 0; i + 2 < s.length; i++) {
+    const g = (charCode(s.charCodeAt(i)) * ALPHABET + charCode(s.charCodeAt(i + 1))) * ALPHABET + charCode(s.charCodeAt(i + 2));
+    if (!out.includes(g)) out.push(g);
+  }
+  return out;
+}
+
+export function buildIndex(ref) {
+  const n = ref.count;
+  const syms = new Array(n);
+  for (let i = 0; i < n; i++) syms[i] = ref.symbol(i);
+
+  // ---------- rank
+  let newest = 0;
+  for (let i = 0; i < n; i++) newest = Math.max(newest, ref.lastActive[i]);
+  const rank = new Float32Array(n);
+  for (let i = 0; i < n; i++) rank[i] = Math.log10(1 + ref.liquidity[i]) - (newest - ref.lastActive[i]) / 365;
+
+  // ---------- ticker trie
+  const order = Uint32Array.from(syms.keys()).sort((a, b) => (syms[a] < syms[b] ? -1 : syms[a] > syms[b] ? 1 : 0));
+  const ch = [0];
+  const first = [-1];
+  const next = [-1];
+  const lo = [0];
+  const hi = [n];
+  const stack = [[0, 0]]; // [node, depth]
+  while (stack.length) {
+    const [node, depth] = stack.pop();
+    let i = lo[node];
+    while (i < hi[node] && syms[order[i]].length === depth) i++; // ids ending here sort first
+    let prev = -1;
+    while (i < hi[node]) {
+      const c = syms[order[i]].charCodeAt(depth);
+      let j = i + 1;
+      while (j < hi[node] && syms[order[j]].charCodeAt(depth) === c) j++;
+      const child = ch.length;
+      ch.push(c);
+      first.push(-1);
+      next.push(-1);
+      lo.push(i);
+      hi.push(j);
+      if (prev < 0) first[node] = child;
+      else next[prev] = child;
+      prev = child;
+      stack.push([child, depth + 1]);
+      i = j;
+    }
+  }
+  const nodes = ch.length;
+  const topStart = new Int32Array(nodes).fill(-1);
+  const topPool = [];
+  for (let node = 0; node < nodes; node++) {
+    if (hi[node] - lo[node] <= TOP_K) continue;
+    topStart[node] = topPool.length;
+    topPool.push(...topByRank(order, lo[node], hi[node], rank, TOP_K));
+  }
+
+  // ---------- name trigrams (CSR)
+  const gramCount = new Uint32Array(GRAMS + 1);
+  const scratch = [];
+  const names = new Array(n);
+  for (let i = 0; i < n; i++) {
+    names[i] = normalize(ref.name(i));
+    gramsOf(names[i], scratch).forEach((g) => gramCount[g + 1]++);
+  }
+  for (let g = 0; g < GRAMS; g++) gramCount[g + 1] += gramCount[g];
+  const gramIds = new Uint32Array(gramCount[GRAMS]);
+  const fill = gramCount.slice(0, GRAMS);
+  for (let i = 0; i < n; i++) gramsOf(names[i], scratch).forEach((g) => (gramIds[fill[g]++] = i));
+
+  return {
+    count: n,
+    rank,
+    order,
+    trie: {
+      ch: Uint8Array.from(ch),
+      first: Int32Array.from(first),
+      next: Int32Array.from(next),
+      lo: Uint32Array.from(lo),
+      hi: Uint32Array.from(hi),
+      topStart,
+      topPool: Uint32Array.from(topPool),
+    },
+    gramOffsets: gramCount,
+    gramIds,
+  };
+}
+
+function topByRank(order, from, to, rank, k) {
+  const top = [];
+  for (let i = from; i < to; i++) {
+    const id = order[i];
+    if (top.length === k && rank[id] <= rank[top[k - 1]]) continue;
+    let p = Math.min(top.length, k - 1);
+    top[p] = id;
+    while (p > 0 && rank[top[p - 1]] < rank[id]) {
+      top[p] = top[p - 1];
+      top[--p] = id;
+    }
+  }
+  return top;
+}
+
+// ---------- queries
+// ids whose symbol starts with q: exact match first, then by rank
+export function searchTickers(idx, symbols, q, limit = TOP_K) {
+  const { ch, first, next, lo, hi, topStart, topPool } = idx.trie;
+  const key = q.toUpperCase().replace(/[^A-Z0-9.]/g, "");
+  if (!key) return [];
+  let node = 0;
+  for (let d = 0; d < key.length && node >= 0; d++) {
+    const c = key.charCodeAt(d);
+    let child = first[node];
+    while (child >= 0 && ch[child] !== c) child = next[child];
+    node = child;
+  }
+  if (node < 0) return [];
+  const out = [];
+  const exact = idx.order[lo[node]];
+  const hasExact = symbols(exact).length === key.length;
+  if (hasExact) out.push(exact);
+  const ranked = topStart[node] >= 0 ? topPool.subarray(topStart[node], topStart[node] + TOP_K) : topByRank(idx.order, lo[node], hi[node], idx.rank, TOP_K);
+  for (let i = 0; i < ranked.length && out.length < limit; i++) if (!hasExact || ranked[i] !== exact) out.push(ranked[i]);
+  return out;
+}
+
+/**
+ * Fuzzy name match: candidates must share at least `minRatio` of the query's trigrams.
+ * `counts` is a caller-owned Uint8Array(count) scratch buffer (left zeroed on return).
+ */
+export function searchNames(idx, q, counts, { limit = TOP_K, minRatio = 0.6, exclude = [] } = {}) {
+  const { gramOffsets, gramIds } = idx;
+  const grams = gramsOf(normalize(q.slice(0, 64))); // keeps per-id counts within Uint8
+  if (!grams.length) return [];
+  const need = Math.max(1, Math.ceil(grams.length * minRatio));
+  // rarest lists first; any id reaching `need` must appear in one of the first (len - need + 1)
+  const size = (g) => gramOffsets[g + 1] - gramOffsets[g];
+  grams.sort((a, b) => size(a) - size(b));
+  const seeds = grams.length - need + 1;
+  const touched = [];
+  grams.forEach((g, k) => {
+    const from = gramOffsets[g];
+    const to = gramOffsets[g + 1];
+    if (k < seeds) {
+      for (let p = from; p < to; p++) if (counts[gramIds[p]]++ === 0) touched.push(gramIds[p]);
+    } else if (touched.length * 16 < to - from) {
+      // lists are id-sorted: probe each candidate instead of scanning a long list
+      touched.forEach((id) => {
+        let l = from;
+        let h = to;
+        while (l < h) {
+          const m = (l + h) >>> 1;
+          if (gramIds[m] < id) l = m + 1;
+          else h = m;
+        }
+        if (l < to && gramIds[l] === id) counts[id]++;
+      });
+    } else {
+      for (let p = from; p < to; p++) if (counts[gramIds[p]]) counts[gramIds[p]]++;
+    }
+  });
+  const scored = [];
+  touched.forEach((id) => {
+    const c = counts[id];
+    counts[id] = 0;
+    if (c < need || exclude.includes(id)) return;
+    const score = c / grams.length + idx.rank[id] / 100;
+    if (scored.length === limit && score <= scored[limit - 1].score) return;
+    let p = Math.min(scored.length, limit - 1);
+    scored[p] = { id, score };
+    while (p > 0 && scored[p - 1].score < score) {
+      scored[p] = scored[p - 1];
+      scored[--p] = { id, score };
+    }
+  });
+  return scored.map((s) => s.id);
+}
@@ -0,0 +1,43 @@
+import { hashSymbol, instrumentsFromRows } from './refdata';
+import { buildIndex, searchTickers, searchNames } from './instrumentIndex';
+
+const rows = [
+  { sym: 'AAPL', name: 'Apple Inc.', liquidity: 1e10 },
+  { sym: 'AAP', name: 'Advance Auto Parts', liquidity: 1e7 },
+  { sym: 'AMZN', name: 'Amazon.com Inc.', liquidity: 9e9 },
+  { sym: 'MSFT', name: 'Microsoft Corp.', liquidity: 8e9 },
+  { sym: 'A', name: 'Agilent Technologies', liquidity: 1e8 },
+];
+const ref = instrumentsFromRows(rows);
+const idx = buildIndex(ref);
+const syms = (ids) => ids.map((id) => ref.symbol(id));
+
+test('ticker prefix puts the exact match first, then ranks by liquidity', () => {
+  expect(syms(searchTickers(idx, ref.symbol, 'aap'))).toEqual(['AAP', 'AAPL']);
+  expect(syms(searchTickers(idx, ref.symbol, 'A'))).toEqual(['A', 'AAPL', 'AMZN', 'AAP']);
+  expect(searchTickers(idx, ref.symbol, 'ZZZ')).toEqual([]);
+});
+
+test('name search tolerates typos', () => {
+  const counts = new Uint8Array(ref.count);
+  expect(syms(searchNames(idx, 'microsft', counts))).toEqual(['MSFT']);
+  expect(counts.every((c) => c === 0)).toBe(true);
+});
+
+test('reference rows get dictionary-coded sector and currency and a symbol -> id lookup', () => {
+  const ref2 = instrumentsFromRows([
+    { sym: 'AAPL', name: 'Apple Inc.', sector: 'Technology', tickSize: 0.01 },
+    { sym: '7203', name: 'Toyota Motor', sector: 'Consumer', currency: 'JPY', tickSize: 1, lotSize: 100 },
+    { sym: 'MSFT', name: 'Microsoft Corp.', sector: 'Technology' },
+  ]);
+  expect(ref2.sectors).toEqual(['Technology', 'Consumer']);
+  expect(Array.from(ref2.sectorCode)).toEqual([0, 1, 0]);
+  expect(ref2.currency(1)).toBe('JPY');
+  expect(ref2.currency(2)).toBe('USD');
+  expect(ref2.lotSize[1]).toBe(100);
+  expect(ref2.idOf('MSFT')).toBe(2);
+  expect(ref2.idOf('NOPE')).toBe(-1);
+  // FNV-1a reference values; scripts/gen-instruments.js must agree
+  expect(hashSymbol('')).toBe(0x811c9dc5);
+  expect(hashSymbol('a')).toBe(0xe40c292c);
+});
@@ -0,0 +1,69 @@
+import { useEffect, useRef, useState } from "react";
+import { spawnInstrumentSearchWorker } from "./workers";
+import { perfHud } from "./perfHud";
+
+/**
+ * Main-thread side of the instrument search worker.
+ * useInstrumentSearch(query) streams results: ticker prefix matches land first, fuzzy name
+ * matches are appended when the worker's second pass answers. Stale sequences are dropped.
+ */
+
+// used by the worker when public/data/instruments.bin is missing
+const FALLBACK = [
+  { sym: "AAPL", name: "Apple Inc." },
+  { sym: "MSFT", name: "Microsoft Corp." },
+  { sym: "GOOG", name: "Alphabet Inc." },
+  { sym: "AMZN", name: "Amazon.com Inc." },
+  { sym: "TSLA", name: "Tesla Inc." },
+  { sym: "NVDA", name: "NVIDIA Corp." },
+  { sym: "BTC", name: "Bitcoin" },
+  { sym: "ETH", name: "Ethereum" },
+];
+
+let worker;
+let seq = 0;
+const listeners = new Set();
+
+function getWorker() {
+  if (worker === undefined) {
+    worker = spawnInstrumentSearchWorker();
+    if (worker) {
+      worker.onmessage = ({ data }) => {
+        // one per query: its tickers pass, or "dropped" if it was superseded while the index loaded
+        if ((data.type === "results" && data.phase === "tickers") || data.type === "dropped") perfHud.queueAdd("search", -1);
+        listeners.forEach((l) => l(data));
+      };
+      worker.postMessage({ type: "init", fallback: FALLBACK });
+    }
+  }
+  return worker;
+}
+
+export function useInstrumentSearch(query) {
+  const [state, setState] = useState({ items: [], tookMs: 0, pending: false });
+  const current = useRef(0);
+  useEffect(() => {
+    const onMessage = (msg) => {
+      if (msg.type !== "results" || msg.seq !== current.current) return;
+      setState((s) =>
+        msg.phase === "tickers"
+          ? { items: msg.items, tookMs: msg.tookMs, pending: true }
+          : { items: s.items.concat(msg.items), tookMs: s.tookMs + msg.tookMs, pending: false }
+      );
+    };
+    listeners.add(onMessage);
+    return () => listeners.delete(onMessage);
+  }, []);
+  useEffect(() => {
+    const w = getWorker();
+    const q = query.trim();
+    current.current = ++seq;
+    if (!w || !q) {
+      setState({ items: [], tookMs: 0, pending: false });
+      return;
+    }
+    perfHud.queueAdd("search", 1);
+    w.postMessage({ type: "query", seq: current.current, q });
+  }, [query]);
+  return state;
+}
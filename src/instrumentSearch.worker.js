@@ -0,0 +1,86 @@
+/* eslint-disable no-restricted-globals */
+import { readInstruments, instrumentsFromRows } from "./refdata";
+import { buildIndex, searchTickers, searchNames } from "./instrumentIndex";
+import { idbGet, idbPut } from "./idb";
+
+/**
+ * Instrument search worker
+ *   in:  { type: "init", fallback: [{ sym, name }] } | { type: "query", seq, q }
+ *   out: { type: "ready", count, source, buildMs } |
+ *        { type: "results", seq, phase: "tickers" | "names", items: [{ id, sym, name }], tookMs } |
+ *        { type: "dropped", seq }  – a query superseded before the index was ready; never answered
+ * The built index is cached in IndexedDB together with the file and revalidated by ETag,
+ * so a warm start neither re-downloads nor re-tokenizes the universe. `id` is the instrument's
+ * row in instruments.bin – the same `iid` api.js puts on instrument entities.
+ */
+
+const FILE_URL = `${process.env.PUBLIC_URL || ""}/data/instruments.bin`;
+const CACHE_KEY = "instrument-index";
+const INDEX_VERSION = 2; // bump when buildIndex output changes shape
+
+let state = null; // { ref, idx, counts }
+let latest = 0;
+let queued = null;
+
+const use = (ref, idx, source, buildMs) => {
+  state = { ref, idx, counts: new Uint8Array(ref.count) };
+  self.postMessage({ type: "ready", count: ref.count, source, buildMs });
+  if (queued) query(queued);
+  queued = null;
+};
+
+async function fetchAndBuild(etag) {
+  const res = await fetch(FILE_URL, etag ? { headers: { "If-None-Match": etag } } : undefined);
+  if (res.status === 304) return;
+  if (!res.ok) throw new Error(`instruments.bin: HTTP ${res.status}`);
+  const file = await res.arrayBuffer();
+  const t0 = performance.now();
+  const ref = readInstruments(file);
+  const index = buildIndex(ref);
+  use(ref, index, "network", performance.now() - t0);
+  idbPut("cache", CACHE_KEY, { indexVersion: INDEX_VERSION, etag: res.headers.get("ETag"), file, index }).catch(() => {});
+}
+
+async function load(fallback) {
+  const cached = await idbGet("cache", CACHE_KEY).catch(() => null);
+  if (cached && cached.indexVersion === INDEX_VERSION) {
+    use(readInstruments(cached.file), cached.index, "cache", 0);
+    fetchAndBuild(cached.etag).catch(() => {}); // revalidate in the background
+    return;
+  }
+  try {
+    await fetchAndBuild(null);
+  } catch (e) {
+    const t0 = performance.now();
+    const ref = instrumentsFromRows(fallback);
+    use(ref, buildIndex(ref), "fallback", performance.now() - t0);
+  }
+}
+
+const toItems = (ids) => ids.map((id) => ({ id, sym: state.ref.symbol(id), name: state.ref.name(id) }));
+
+// tickers answer immediately; the fuzzy name pass follows as its own task unless a newer query arrived
+function query({ seq, q }) {
+  const { ref, idx, counts } = state;
+  let t0 = performance.now();
+  const tickers = searchTickers(idx, ref.symbol, q);
+  self.postMessage({ type: "results", seq, phase: "tickers", items: toItems(tickers), tookMs: performance.now() - t0 });
+  setTimeout(() => {
+    if (seq !== latest) return;
+    t0 = performance.now();
+    const names = q.trim().length >= 3 ? searchNames(idx, q, counts, { exclude: tickers }) : [];
+    self.postMessage({ type: "results", seq, phase: "names", items: toItems(names), tookMs: performance.now() - t0 });
+  }, 0);
+}
+
+self.onmessage = ({ data }) => {
+  if (data.type === "init") load(data.fallback || []);
+  else if (data.type === "query") {
+    latest = data.seq;
+    if (state) query(data);
+    else {
+      if (queued) self.postMessage({ type: "dropped", seq: queued.seq });
+      queued = data;
+    }
+  }
+};
@@ -0,0 +1,52 @@
+import React, { lazy } from "react";
+import ROLE_CHUNKS from "./roleChunks.json";
+
+/**
+ * Lazy widget chunks
+ * - One webpack chunk per heavy widget; recharts ends up in a shared vendor chunk
+ * - roleChunks.json lists what each role can actually render, so a Viewer never fetches ApexCharts
+ *   (scripts/bundle-report.js reads the same file to check that against the build)
+ * - preloadForRole() fetches them all at once while a login is being checked; prefetchForRole()
+ *   warms them at idle time after login (import() promises are cached, so the two never double up)
+ */
+
+// keyed by webpack chunk name
+const loaders = {
+  "w-line-area": () => import(/* webpackChunkName: "w-line-area" */ "./widgets/LineArea"),
+  "w-donut": () => import(/* webpackChunkName: "w-donut" */ "./widgets/Donut"),
+  "w-candlestick": () => import(/* webpackChunkName: "w-candlestick" */ "./widgets/CandleStick"),
+  "w-system-health": () => import(/* webpackChunkName: "w-system-health" */ "./widgets/SystemHealth"),
+  "w-news": () => import(/* webpackChunkName: "w-news" */ "./widgets/NewsPane"),
+  "w-latency-overlay": () => import(/* webpackChunkName: "w-latency-overlay" */ "./widgets/LatencyOverlay"), // debug only, no role
+  "w-perf-hud": () => import(/* webpackChunkName: "w-perf-hud" */ "./widgets/PerfHud"), // fetched when an Admin opens it
+};
+
+export const LineArea = lazy(loaders["w-line-area"]);
+export const Donut = lazy(loaders["w-donut"]);
+export const CandleStick = lazy(loaders["w-candlestick"]);
+export const SystemHealth = lazy(loaders["w-system-health"]);
+export const NewsPane = lazy(loaders["w-news"]);
+export const LatencyOverlay = lazy(loaders["w-latency-overlay"]);
+export const PerfHud = lazy(loaders["w-perf-hud"]);
+
+// resolves once every chunk the role renders is loaded
+export const preloadForRole = (role) => Promise.all((ROLE_CHUNKS[role] || ROLE_CHUNKS.Viewer).map((c) => loaders[c]()));
+
+// returns a cancel fn so it can be used directly as an effect cleanup
+export function prefetchForRole(role) {
+  const queue = (ROLE_CHUNKS[role] || ROLE_CHUNKS.Viewer).slice();
+  let handle = 0;
+  const idle = typeof requestIdleCallback === "function" ? requestIdleCallback : (cb) => setTimeout(() => cb({ timeRemaining: () => 50 }), 200);
+  const cancel = typeof cancelIdleCallback === "function" ? cancelIdleCallback : clearTimeout;
+  const step = (deadline) => {
+    // one chunk per idle slice keeps the network and parser out of the way of input
+    if (deadline.timeRemaining() > 5) loaders[queue.shift()]().catch(() => {});
+    if (queue.length) handle = idle(step);
+  };
+  handle = idle(step);
+  return () => cancel(handle);
+}
+
+export function WidgetSkeleton({ className = "h-40" }) {
+  return <div className={`${className} rounded-xl bg-slate-800/40 animate-pulse`} />;
+}
@@ -0,0 +1,4 @@
+import { domMax } from "framer-motion";
+
+// Loaded on demand by <LazyMotion>; domMax is needed for StatCard's layout animations.
+export default domMax;
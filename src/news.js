@@ -0,0 +1,68 @@
+import { useEffect, useRef, useState } from "react";
+import { spawnNewsWorker } from "./workers";
+import { perfHud } from "./perfHud";
+
+/**
+ * Main-thread side of the news worker.
+ * useNews(query, tickers) returns the live headline list while the query is empty and BM25
+ * results otherwise. The wire keeps ingesting either way; stale query answers are dropped.
+ */
+
+let worker;
+let seq = 0;
+let latest = { items: [], docs: 0 };
+const listeners = new Set();
+
+function getWorker(tickers) {
+  if (worker === undefined) {
+    worker = spawnNewsWorker();
+    if (worker) {
+      worker.onmessage = ({ data }) => {
+        if (data.type === "latest") latest = data;
+        else if (data.type === "results") perfHud.queueAdd("news", -1);
+        listeners.forEach((l) => l(data));
+      };
+      worker.postMessage({ type: "init", tickers });
+    }
+  }
+  return worker;
+}
+
+export function useNews(query, tickers) {
+  const [live, setLive] = useState(latest);
+  const [results, setResults] = useState(null); // { items, total, tookMs } | null
+  const current = useRef(0);
+  const q = query.trim();
+
+  useEffect(() => {
+    const onMessage = (msg) => {
+      if (msg.type === "latest") setLive(msg);
+      else if (msg.type === "results" && msg.seq === current.current) setResults(msg);
+    };
+    listeners.add(onMessage);
+    getWorker(tickers);
+    setLive(latest);
+    return () => listeners.delete(onMessage);
+    // eslint-disable-next-line react-hooks/exhaustive-deps
+  }, []);
+
+  useEffect(() => {
+    const w = getWorker(tickers);
+    current.current = ++seq;
+    if (!w || !q) {
+      setResults(null);
+      return;
+    }
+    // debounce keystrokes; an in-flight answer for an older seq is ignored on arrival
+    const id = setTimeout(() => {
+      perfHud.queueAdd("news", 1);
+      w.postMessage({ type: "query", seq: current.current, q, limit: 30 });
+    }, 60);
+    return () => clearTimeout(id);
+    // eslint-disable-next-line react-hooks/exhaustive-deps
+  }, [q]);
+
+  return q && results
+    ? { items: results.items, total: results.total, tookMs: results.tookMs, docs: live.docs, searching: true }
+    : { items: live.items, total: live.items.length, tookMs: 0, docs: live.docs, searching: !!q };
+}
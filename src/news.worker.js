@@ -0,0 +1,57 @@
+/* eslint-disable no-restricted-globals */
+import { createNewsIndex } from "./newsIndex";
+import { createHeadlineGenerator } from "./newsFeed";
+
+/**
+ * News worker: owns the headline index and the (mock) wire that feeds it
+ *   in:  { type: "init", tickers: string[] } | { type: "query", seq, q, limit }
+ *   out: { type: "latest", items, docs } – at most once per PUSH_MS while headlines arrive
+ *        { type: "results", seq, items, total, tookMs }
+ * Headlines are indexed as they arrive; nothing is ever rebuilt.
+ */
+
+const BACKFILL = 50000; // history indexed at start-up, ~1 minute apart
+const RATE_PER_SEC = 20;
+const PUSH_MS = 1000;
+const LATEST = 30;
+
+let index = null;
+let dirty = false;
+let queued = null;
+
+function query({ seq, q, limit = LATEST }) {
+  const t0 = performance.now();
+  const { items, total } = index.search(q, limit);
+  self.postMessage({ type: "results", seq, items, total, tookMs: performance.now() - t0 });
+}
+
+function start(tickers) {
+  index = createNewsIndex({ tickers: new Set(tickers) });
+  const next = createHeadlineGenerator(tickers, Date.now() & 0xffff);
+  const now = Date.now();
+  for (let i = BACKFILL; i > 0; i--) index.add(next(now - i * 60000));
+  dirty = true;
+  if (queued) query(queued);
+  queued = null;
+
+  setInterval(() => {
+    index.add(next(Date.now()));
+    dirty = true;
+  }, 1000 / RATE_PER_SEC);
+  // the list view only needs a refresh per second, not per headline
+  const push = () => {
+    if (dirty) self.postMessage({ type: "latest", items: index.latest(LATEST), docs: index.stats().docs });
+    dirty = false;
+  };
+  push();
+  setInterval(push, PUSH_MS);
+}
+
+self.onmessage = ({ data }) => {
+  if (data.type === "init") {
+    if (!index) start(data.tickers || []);
+  } else if (data.type === "query") {
+    if (index) query(data);
+    else queued = data;
+  }
+};
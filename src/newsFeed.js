@@ -0,0 +1,33 @@
+/**
+ * Mock headline wire (stands in for a news WebSocket, like usePriceFeed does for prices).
+ * Deterministic per seed so benchmarks and tests see the same corpus.
+ */
+
+const SOURCES = ["Reuters", "Bloomberg", "WSJ", "FT", "CNBC", "MarketWatch"];
+const SUBJECTS = ["shares", "stock", "bonds", "options volume", "guidance", "revenue", "margins", "buyback", "dividend", "outlook"];
+const MOVES = ["jump", "slide", "rally", "slip", "surge", "fall", "edge higher", "edge lower", "hold steady", "rebound"];
+const CAUSES = [
+  "after earnings beat",
+  "on analyst upgrade",
+  "as regulators open probe",
+  "amid supply chain concerns",
+  "after CEO comments",
+  "on strong cloud demand",
+  "as chip shortage eases",
+  "ahead of Fed decision",
+  "on merger talks",
+  "after product launch",
+  "as inflation data cools",
+  "on weak consumer spending",
+];
+
+export function createHeadlineGenerator(tickers, seed = 7) {
+  let s = seed >>> 0;
+  const rnd = () => ((s = (s * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+  const pick = (a) => a[Math.floor(rnd() * a.length)];
+  return (ts = Date.now()) => {
+    const sym = pick(tickers);
+    const other = rnd() < 0.2 ? ` and ${pick(tickers)}` : "";
+    return { title: `${sym}${other} ${pick(SUBJECTS)} ${pick(MOVES)} ${pick(CAUSES)}`, ts, source: pick(SOURCES) };
+  };
+}
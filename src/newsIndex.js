@@ -0,0 +1,169 @@
+/**
+ * In-memory news full-text index (pure; lives in news.worker.js)
+ * - Documents go into the open segment; a full segment is sealed and a new one opened
+ * - Postings per segment and term: varint(docId delta) varint(tf) in a growable byte buffer
+ * - Memory is bounded by dropping the oldest segment once there are more than maxSegments
+ * - Ranking: BM25 (k1 = 1.2, b = 0.75) over the live documents
+ */
+
+const K1 = 1.2;
+const B = 0.75;
+const STOP = new Set("a an and are as at be by for from has in is it its of on or that the to was were will with".split(" "));
+
+// lowercase word tokens; known tickers are reported separately (and indexed as terms too)
+export function tokenize(text, tickers) {
+  const terms = [];
+  const found = [];
+  const re = /\$?[A-Za-z0-9][A-Za-z0-9.&-]*/g;
+  let m;
+  while ((m = re.exec(text))) {
+    const raw = m[0].replace(/^\$/, "").replace(/[.&-]+$/, "");
+    if (tickers && tickers.has(raw) && !found.includes(raw)) found.push(raw);
+    const t = raw.toLowerCase();
+    if (t.length < 2 || STOP.has(t)) continue;
+    terms.push(t);
+  }
+  return { terms, tickers: found };
+}
+
+// ---------- varint posting buffers
+const newPostings = () => ({ bytes: new Uint8Array(16), len: 0, last: -1, df: 0 });
+
+function writeVarint(p, v) {
+  if (p.len + 5 > p.bytes.length) {
+    const next = new Uint8Array(p.bytes.length * 2);
+    next.set(p.bytes);
+    p.bytes = next;
+  }
+  while (v >= 0x80) {
+    p.bytes[p.len++] = (v & 0x7f) | 0x80;
+    v >>>= 7;
+  }
+  p.bytes[p.len++] = v;
+}
+
+function appendPosting(p, localId, tf) {
+  writeVarint(p, localId - p.last);
+  writeVarint(p, tf);
+  p.last = localId;
+  p.df++;
+}
+
+// Decodes one posting list and adds its BM25 contribution into `scores` (hot loop, kept inline).
+function scorePostings(p, idf, lens, avgdl, scores) {
+  const { bytes, len } = p;
+  const lenScale = (K1 * B) / avgdl;
+  const base = K1 * (1 - B);
+  let i = 0;
+  let doc = -1;
+  while (i < len) {
+    let b = bytes[i++];
+    let v = b & 0x7f;
+    for (let shift = 7; b & 0x80; shift += 7) {
+      b = bytes[i++];
+      v |= (b & 0x7f) << shift;
+    }
+    doc += v;
+    b = bytes[i++];
+    let tf = b & 0x7f;
+    for (let shift = 7; b & 0x80; shift += 7) {
+      b = bytes[i++];
+      tf |= (b & 0x7f) << shift;
+    }
+    scores[doc] += (idf * tf * (K1 + 1)) / (tf + base + lenScale * lens[doc]);
+  }
+}
+
+// newer headlines win ties (duplicate wire stories score identically)
+const better = (a, b) => a.score > b.score || (a.score === b.score && a.doc.ts > b.doc.ts);
+
+const newSegment = (base, size) => ({ base, count: 0, docs: new Array(size), lens: new Uint16Array(size), terms: new Map(), totalLen: 0 });
+
+export function createNewsIndex({ segmentDocs = 65536, maxSegments = 16, tickers = new Set() } = {}) {
+  const segments = [newSegment(0, segmentDocs)];
+  const scores = new Float32Array(segmentDocs); // per-segment scratch
+  let nextId = 0;
+
+  const live = () => segments.reduce((n, s) => n + s.count, 0);
+
+  function add({ title, ts, source }) {
+    let seg = segments[segments.length - 1];
+    if (seg.count === segmentDocs) {
+      seg = newSegment(nextId, segmentDocs);
+      segments.push(seg);
+      if (segments.length > maxSegments) segments.shift(); // age out the oldest headlines
+    }
+    const { terms, tickers: syms } = tokenize(title, tickers);
+    const local = seg.count++;
+    const tf = new Map();
+    terms.forEach((t) => tf.set(t, (tf.get(t) || 0) + 1));
+    tf.forEach((n, t) => {
+      let p = seg.terms.get(t);
+      if (!p) seg.terms.set(t, (p = newPostings()));
+      appendPosting(p, local, n);
+    });
+    seg.docs[local] = { id: nextId, title, ts, source, tickers: syms };
+    seg.lens[local] = Math.min(terms.length, 65535);
+    seg.totalLen += terms.length;
+    return nextId++;
+  }
+
+  function search(query, limit = 20) {
+    const { terms } = tokenize(query);
+    const uniq = Array.from(new Set(terms));
+    if (!uniq.length) return { items: [], total: 0 };
+    const N = live();
+    const avgdl = segments.reduce((n, s) => n + s.totalLen, 0) / Math.max(1, N);
+    const idf = uniq.map((t) => {
+      const df = segments.reduce((n, s) => n + (s.terms.has(t) ? s.terms.get(t).df : 0), 0);
+      return Math.log(1 + (N - df + 0.5) / (df + 0.5));
+    });
+    const top = []; // [{ score, doc }] descending, length <= limit
+    let total = 0;
+    // Newest segment first and a dense newest-first sweep of the scratch scores, so score ties
+    // (syndicated copies of one story) fail the bound check instead of bubbling to the head of `top`
+    for (let s = segments.length - 1; s >= 0; s--) {
+      const seg = segments[s];
+      uniq.forEach((t, k) => {
+        const p = seg.terms.get(t);
+        if (p) scorePostings(p, idf[k], seg.lens, avgdl, scores);
+      });
+      for (let doc = seg.count - 1; doc >= 0; doc--) {
+        const score = scores[doc];
+        if (score === 0) continue;
+        scores[doc] = 0;
+        total++;
+        if (top.length === limit && score <= top[limit - 1].score) continue;
+        const hit = { score, doc: seg.docs[doc] };
+        let i = Math.min(top.length, limit - 1);
+        top[i] = hit;
+        while (i > 0 && better(hit, top[i - 1])) {
+          top[i] = top[i - 1];
+          top[--i] = hit;
+        }
+      }
+    }
+    return { items: top.map((h) => h.doc), total };
+  }
+
+  function latest(n = 20) {
+    const out = [];
+    for (let s = segments.length - 1; s >= 0 && out.length < n; s--) {
+      const seg = segments[s];
+      for (let i = seg.count - 1; i >= 0 && out.length < n; i--) out.push(seg.docs[i]);
+    }
+    return out;
+  }
+
+  const stats = () => ({
+    docs: live(),
+    segments: segments.length,
+    postingBytes: segments.reduce((n, s) => {
+      let b = 0;
+      s.terms.forEach((p) => (b += p.bytes.length));
+      return n + b;
+    }, 0),
+  });
+
+  return { add, search, latest, stats };
+}
@@ -0,0 +1,27 @@
+import { createNewsIndex, tokenize } from './newsIndex';
+
+test('tokenizer drops stop words and reports known tickers', () => {
+  const { terms, tickers } = tokenize('$AAPL and MSFT rally on the Fed decision', new Set(['AAPL', 'MSFT']));
+  expect(terms).toEqual(['aapl', 'msft', 'rally', 'fed', 'decision']);
+  expect(tickers).toEqual(['AAPL', 'MSFT']);
+});
+
+test('BM25 favours the rarer term and newer copies of the same headline', () => {
+  const idx = createNewsIndex({ segmentDocs: 4 });
+  idx.add({ title: 'Chip stocks rally', ts: 1 });
+  idx.add({ title: 'Chip shortage eases', ts: 2 });
+  idx.add({ title: 'Chip stocks slip', ts: 3 });
+  idx.add({ title: 'Bank stocks rally', ts: 4 });
+  idx.add({ title: 'Chip shortage eases', ts: 5 }); // opens a second segment
+  const { items, total } = idx.search('chip shortage');
+  expect(total).toBe(4);
+  expect(items.map((d) => d.ts)).toEqual([5, 2, 3, 1]);
+});
+
+test('oldest segment ages out once the cap is reached', () => {
+  const idx = createNewsIndex({ segmentDocs: 2, maxSegments: 2 });
+  ['merger talks', 'earnings beat', 'guidance cut', 'buyback', 'dividend'].forEach((title, ts) => idx.add({ title, ts }));
+  expect([idx.stats().docs, idx.stats().segments]).toEqual([3, 2]);
+  expect(idx.search('merger').total).toBe(0);
+  expect(idx.latest(2).map((d) => d.title)).toEqual(['dividend', 'buyback']);
+});
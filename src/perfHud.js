@@ -0,0 +1,86 @@
+import { memo, useEffect, useSyncExternalStore } from "react";
+import { renderGovernor } from "./renderGovernor";
+import { telemetry } from "./telemetry";
+
+/**
+ * Admin performance HUD data (the overlay itself is widgets/PerfHud.jsx, behind Topbar's Settings icon)
+ * - FPS, jank and long tasks come from the render governor's own sampling window
+ * - Commits per widget: <CommitProbe id> counts the commits that reach the widget from its slot (new
+ *   data); re-renders from a widget's own hooks are not seen (Profiler callbacks are dev-build only)
+ * - Feed ticks in / rendered: telemetry.js (the worker's counts vs. symbols changed per React commit)
+ * - Worker queue depths: requests posted to a worker and not answered yet, kept by each client
+ * - JS heap: performance.memory where the browser has it (Chromium)
+ * - Sampling (1 Hz) and commit counting run only while the overlay is open; queue depths are plain
+ *   counters the clients keep regardless, so they are right the moment it opens
+ */
+
+let active = false;
+let commits = new Map(); // widget id -> commits since the last sample
+const queues = new Map(); // worker -> depth
+const listeners = new Set();
+let timer = 0;
+let stopTelemetry = null;
+let last = 0;
+let snap = { fps: 0, jank: 0, longTasks: 0, longTaskMs: 0, heap: null, commits: [], queues: [], ticksIn: 0, rendered: 0 };
+
+function sample() {
+  const now = performance.now();
+  const secs = Math.max(now - last, 1) / 1000;
+  last = now;
+  const g = renderGovernor.getStats();
+  const t = telemetry.getSnapshot();
+  const mem = performance.memory;
+  snap = {
+    fps: g.fps,
+    jank: g.jankRatio,
+    longTasks: g.longTasks || 0,
+    longTaskMs: Math.round(g.longTaskMs),
+    heap: mem ? { used: mem.usedJSHeapSize, limit: mem.jsHeapSizeLimit } : null,
+    commits: Array.from(commits, ([id, n]) => ({ id, perSec: Math.round((n / secs) * 10) / 10 })).sort((a, b) => b.perSec - a.perSec),
+    queues: Array.from(queues, ([name, depth]) => ({ name, depth })),
+    ticksIn: t.rate,
+    rendered: t.rendered,
+  };
+  commits = new Map();
+  listeners.forEach((l) => l());
+}
+
+export const perfHud = {
+  active: () => active,
+  commit(id) {
+    if (active) commits.set(id, (commits.get(id) || 0) + 1);
+  },
+  // worker clients: queueAdd("search", +1) on post, -1 on the final answer; queueSet for absolute depths
+  queueAdd(name, d) {
+    queues.set(name, Math.max(0, (queues.get(name) || 0) + d));
+  },
+  queueSet(name, n) {
+    queues.set(name, n);
+  },
+  subscribe(listener) {
+    listeners.add(listener);
+    if (listeners.size === 1) {
+      active = true;
+      last = performance.now();
+      commits = new Map();
+      stopTelemetry = telemetry.subscribe(() => {}); // turns on the worker's tick counts
+      timer = setInterval(sample, 1000);
+    }
+    return () => {
+      listeners.delete(listener);
+      if (listeners.size) return;
+      active = false;
+      clearInterval(timer);
+      stopTelemetry();
+    };
+  },
+  getSnapshot: () => snap,
+};
+
+export const usePerfHud = () => useSyncExternalStore(perfHud.subscribe, perfHud.getSnapshot);
+
+// Counts its subtree's commits for the HUD; memo so it re-renders only when `children` changes
+export const CommitProbe = memo(function CommitProbe({ id, children }) {
+  useEffect(() => perfHud.commit(id));
+  return children;
+});
@@ -0,0 +1,146 @@
+import { useCallback, useSyncExternalStore } from "react";
+import { idbEntries, idbPutMany } from "./idb";
+
+/**
+ * User preferences (theme, role, dashboard layouts, alert rules): an in-memory copy is the source of truth
+ * - load() hydrates it from IndexedDB once, before the first render (index.js); every read after
+ *   that is a Map lookup, never storage I/O or JSON on the main thread
+ * - Writes update memory and notify subscribers at once; changed keys are written at idle time,
+ *   all in one transaction, and flushed right away on pagehide / hidden
+ * - Schema versioning: the stored version lives under META and load() runs every newer entry of
+ *   MIGRATIONS over the stored entries before use (v1 moves useLocal's localStorage keys over, v2
+ *   feed.js's alert rules)
+ * - SYNCED keys go out on the "fs:prefs" BroadcastChannel, so theme and role follow across tabs;
+ *   the tab that made the change is the one that writes it
+ * - Without IndexedDB (private mode, tests) preferences last for the session only
+ */
+
+const STORE = "prefs";
+const META = "__schema";
+const SYNCED = new Set(["fs:dark", "fs:role"]);
+
+// moves the localStorage keys matching `pattern` into the stored entries
+const fromLegacy = (pattern) => (entries, { legacy, after }) => {
+  if (!legacy) return;
+  const keys = [];
+  for (let i = 0; i < legacy.length; i++) if (pattern.test(legacy.key(i))) keys.push(legacy.key(i));
+  keys.forEach((k) => {
+    try {
+      if (!entries.has(k)) entries.set(k, JSON.parse(legacy.getItem(k)));
+    } catch (e) {
+      // unreadable: dropped with the rest
+    }
+  });
+  after.push(() => keys.forEach((k) => legacy.removeItem(k)));
+};
+
+// MIGRATIONS[v] takes stored entries from schema v to v + 1; `after` runs once they are committed
+const MIGRATIONS = [fromLegacy(/^fs:(dark|role|layout:.+)$/), fromLegacy(/^fs:alerts$/)];
+export const SCHEMA = MIGRATIONS.length;
+
+const idle = (fn) => (typeof requestIdleCallback === "function" ? requestIdleCallback(fn, { timeout: 2000 }) : setTimeout(fn, 200));
+const openChannel = () => (typeof BroadcastChannel === "function" ? new BroadcastChannel("fs:prefs") : null);
+
+export function createPrefs({
+  store = { entries: () => idbEntries(STORE), putMany: (entries) => idbPutMany(STORE, entries) },
+  channel = openChannel(),
+  legacy = typeof localStorage !== "undefined" ? localStorage : null,
+  schedule = idle,
+} = {}) {
+  const values = new Map();
+  const listeners = new Map(); // key -> Set
+  const dirty = new Set();
+  let loading = null;
+  let persist = false; // set once load() has read (and migrated) the stored entries
+  let pending = false;
+
+  const notify = (key) => {
+    const ls = listeners.get(key);
+    if (ls) ls.forEach((l) => l());
+  };
+
+  function flush() {
+    pending = false;
+    if (!persist || !dirty.size) return;
+    const entries = [...dirty].map((k) => [k, values.get(k)]);
+    dirty.clear();
+    store.putMany(entries).catch(() => {});
+  }
+
+  const write = (key) => {
+    dirty.add(key);
+    if (pending || !persist) return;
+    pending = true;
+    schedule(flush);
+  };
+
+  if (channel) {
+    channel.onmessage = ({ data }) => {
+      if (Object.is(values.get(data.key), data.value)) return;
+      values.set(data.key, data.value);
+      notify(data.key);
+    };
+  }
+
+  const prefs = {
+    // resolves once hydrated, or after `timeout` ms so a slow IndexedDB never holds up first paint
+    load({ timeout = 500 } = {}) {
+      if (!loading) {
+        loading = store
+          .entries()
+          .then((rows) => {
+            const stored = new Map(rows);
+            const from = stored.get(META) || 0;
+            stored.delete(META);
+            const after = [];
+            for (let v = from; v < SCHEMA; v++) MIGRATIONS[v](stored, { legacy, after });
+            stored.forEach((value, key) => {
+              if (values.has(key)) return; // set before the load finished: newer
+              values.set(key, value);
+              notify(key);
+            });
+            persist = true;
+            if (from < SCHEMA) {
+              return store.putMany([...stored, [META, SCHEMA]]).then(() => after.forEach((f) => f()));
+            }
+            return undefined;
+          })
+          .catch(() => {})
+          .then(() => {
+            if (persist && dirty.size) flush();
+          });
+      }
+      return Promise.race([loading, new Promise((r) => setTimeout(r, timeout))]);
+    },
+    get: (key, initial) => (values.has(key) ? values.get(key) : initial),
+    set(key, value) {
+      if (Object.is(values.get(key), value) && values.has(key)) return;
+      values.set(key, value);
+      notify(key);
+      write(key);
+      if (channel && SYNCED.has(key)) channel.postMessage({ key, value });
+    },
+    subscribe(key, listener) {
+      if (!listeners.has(key)) listeners.set(key, new Set());
+      listeners.get(key).add(listener);
+      return () => listeners.get(key).delete(listener);
+    },
+    flush,
+  };
+  return prefs;
+}
+
+export const prefs = createPrefs();
+
+if (typeof window !== "undefined") {
+  window.addEventListener("pagehide", prefs.flush);
+  document.addEventListener("visibilitychange", () => document.visibilityState === "hidden" && prefs.flush());
+}
+
+// drop-in for the old useLocal(key, initial): [value, setValue], setValue also takes an updater
+export function usePref(key, initial) {
+  const subscribe = useCallback((listener) => prefs.subscribe(key, listener), [key]);
+  const value = useSyncExternalStore(subscribe, () => prefs.get(key, initial));
+  const set = useCallback((v) => prefs.set(key, typeof v === "function" ? v(prefs.get(key, initial)) : v), [key, initial]);
+  return [value, set];
+}
@@ -0,0 +1,95 @@
+import { createPrefs, SCHEMA } from './prefs';
+
+// IndexedDB stand-in: records each putMany batch
+const memStore = (rows = []) => {
+  const store = { rows: new Map(rows), batches: [] };
+  store.entries = () => Promise.resolve([...store.rows]);
+  store.putMany = (entries) => {
+    store.batches.push(entries);
+    entries.forEach(([k, v]) => store.rows.set(k, v));
+    return Promise.resolve(entries.length);
+  };
+  return store;
+};
+const manual = () => {
+  const queue = [];
+  const schedule = (fn) => queue.push(fn);
+  schedule.run = () => queue.splice(0).forEach((fn) => fn());
+  return schedule;
+};
+const legacyStorage = (obj) => ({
+  get length() {
+    return Object.keys(obj).length;
+  },
+  key: (i) => Object.keys(obj)[i],
+  getItem: (k) => obj[k],
+  removeItem: (k) => delete obj[k],
+});
+
+test('load migrates the localStorage keys once and earlier sets win', async () => {
+  const old = { 'fs:dark': 'false', 'fs:role': '"Viewer"', 'fs:alerts': '[]' };
+  const store = memStore();
+  const p = createPrefs({ store, channel: null, legacy: legacyStorage(old), schedule: manual() });
+  p.set('fs:role', 'Analyst');
+  await p.load();
+  expect(p.get('fs:dark', true)).toBe(false);
+  expect(p.get('fs:role')).toBe('Analyst');
+  expect(store.rows.get('__schema')).toBe(SCHEMA);
+  expect(store.rows.get('fs:role')).toBe('Analyst');
+  expect(p.get('fs:alerts')).toEqual([]);
+  expect(Object.keys(old)).toEqual([]);
+
+  const again = createPrefs({ store, channel: null, legacy: legacyStorage({ 'fs:dark': 'true' }), schedule: manual() });
+  await again.load();
+  expect(again.get('fs:dark')).toBe(false);
+});
+
+test('a store already at schema 1 picks up the alert rules from localStorage', async () => {
+  const rules = [{ key: 'a1', sym: 'AAPL', kind: 'above', level: 200 }];
+  const old = { 'fs:alerts': JSON.stringify(rules), 'fs:dark': 'true' };
+  const store = memStore([['__schema', 1], ['fs:dark', false]]);
+  const p = createPrefs({ store, channel: null, legacy: legacyStorage(old), schedule: manual() });
+  await p.load();
+  expect(p.get('fs:alerts')).toEqual(rules);
+  expect(p.get('fs:dark')).toBe(false);
+  expect(store.rows.get('__schema')).toBe(SCHEMA);
+  expect(Object.keys(old)).toEqual(['fs:dark']);
+});
+
+test('writes are coalesced into one idle-time batch', async () => {
+  const store = memStore([['__schema', SCHEMA]]);
+  const schedule = manual();
+  const p = createPrefs({ store, channel: null, legacy: null, schedule });
+  await p.load();
+  const seen = [];
+  p.subscribe('fs:layout:Admin', () => seen.push(p.get('fs:layout:Admin')));
+  p.set('fs:layout:Admin', [1]);
+  p.set('fs:layout:Admin', [2]);
+  p.set('fs:dark', false);
+  expect(seen).toEqual([[1], [2]]);
+  expect(store.batches.length).toBe(0);
+  schedule.run();
+  expect(store.batches).toEqual([[['fs:layout:Admin', [2]], ['fs:dark', false]]]);
+});
+
+test('theme and role changes reach the other tabs, which do not write them again', async () => {
+  const channels = [];
+  const channel = () => {
+    const ch = { onmessage: null, postMessage: (data) => channels.forEach((o) => o !== ch && o.onmessage({ data })) };
+    channels.push(ch);
+    return ch;
+  };
+  const stores = [memStore([['__schema', SCHEMA]]), memStore([['__schema', SCHEMA]])];
+  const schedules = [manual(), manual()];
+  const [a, b] = [0, 1].map((i) => createPrefs({ store: stores[i], channel: channel(), legacy: null, schedule: schedules[i] }));
+  await Promise.all([a.load(), b.load()]);
+  let calls = 0;
+  b.subscribe('fs:dark', () => calls++);
+  a.set('fs:dark', false);
+  a.set('fs:layout:Admin', [1]);
+  expect(b.get('fs:dark')).toBe(false);
+  expect(b.get('fs:layout:Admin')).toBeUndefined();
+  expect(calls).toBe(1);
+  schedules[1].run();
+  expect(stores[1].batches.length).toBe(0);
+});
@@ -0,0 +1,133 @@
+/**
+ * Instrument reference file (public/data/instruments.bin, written by scripts/gen-instruments.js)
+ *
+ * Columnar, little-endian, every section 4-byte aligned:
+ *   u32 magic "FSIN" | u16 version | u16 reserved | u32 count | u32 strings | u32 strBytes
+ *   u16 sectors | u16 currencies | u32 hashSlots | u32 reserved                   (32 bytes)
+ *   u32 strOffsets[strings + 1]  – string table: every distinct string once, UTF-8
+ *   u32 sectorNames[sectors] | u32 currencyNames[currencies] – string ids of the two dictionaries
+ *   u32 symbol[count] | u32 name[count] – string ids (symbols are ASCII)
+ *   f32 tickSize[count] | u32 lotSize[count]
+ *   f32 liquidity[count]         – average daily traded value, USD
+ *   u32 lastActive[count]        – last trading day, days since epoch
+ *   u32 hash[hashSlots]          – symbol -> id + 1 (0 = empty): FNV-1a, linear probing, power of two
+ *   u8 sector[count] | u8 currency[count] – dictionary codes
+ *   string blob
+ *
+ * An instrument's id is its row; search results, table rows and portfolio slices all carry it.
+ * readInstruments() returns typed-array views over the buffer: nothing is parsed up front, strings
+ * decode on access and idOf() compares symbol bytes in place.
+ */
+
+export const REFDATA_MAGIC = 0x4e495346; // "FSIN"
+export const REFDATA_VERSION = 2;
+const HEADER = 32;
+const align4 = (n) => (n + 3) & ~3;
+
+// 32-bit FNV-1a over a symbol's (ASCII) char codes; the generator hashes the same bytes
+export function hashSymbol(s) {
+  let h = 0x811c9dc5;
+  for (let i = 0; i < s.length; i++) h = Math.imul(h ^ s.charCodeAt(i), 0x01000193);
+  return h >>> 0;
+}
+
+export function readInstruments(buffer) {
+  const dv = new DataView(buffer);
+  if (dv.getUint32(0, true) !== REFDATA_MAGIC) throw new Error("instruments.bin: bad magic");
+  const version = dv.getUint16(4, true);
+  if (version !== REFDATA_VERSION) throw new Error(`instruments.bin: unsupported version ${version}`);
+  const count = dv.getUint32(8, true);
+  const strings = dv.getUint32(12, true);
+  const strBytes = dv.getUint32(16, true);
+  const sectors = dv.getUint16(20, true);
+  const currencies = dv.getUint16(22, true);
+  const hashSlots = dv.getUint32(24, true);
+  let off = HEADER;
+  const take = (Ctor, n) => {
+    const view = new Ctor(buffer, off, n);
+    off = align4(off + n * Ctor.BYTES_PER_ELEMENT);
+    return view;
+  };
+  const strOffsets = take(Uint32Array, strings + 1);
+  const sectorNames = take(Uint32Array, sectors);
+  const currencyNames = take(Uint32Array, currencies);
+  const symbolIds = take(Uint32Array, count);
+  const nameIds = take(Uint32Array, count);
+  const tickSize = take(Float32Array, count);
+  const lotSize = take(Uint32Array, count);
+  const liquidity = take(Float32Array, count);
+  const lastActive = take(Uint32Array, count);
+  const hash = take(Uint32Array, hashSlots);
+  const sectorCode = take(Uint8Array, count);
+  const currencyCode = take(Uint8Array, count);
+  const blob = take(Uint8Array, strBytes);
+
+  const utf8 = new TextDecoder();
+  const str = (sid) => utf8.decode(blob.subarray(strOffsets[sid], strOffsets[sid + 1]));
+  const ascii = (sid) => String.fromCharCode.apply(null, blob.subarray(strOffsets[sid], strOffsets[sid + 1]));
+  const isSymbol = (id, s) => {
+    const start = strOffsets[symbolIds[id]];
+    if (strOffsets[symbolIds[id] + 1] - start !== s.length) return false;
+    for (let k = 0; k < s.length; k++) if (blob[start + k] !== s.charCodeAt(k)) return false;
+    return true;
+  };
+  // the dictionaries are a handful of entries each
+  const sectorList = Array.from(sectorNames, str);
+  const currencyList = Array.from(currencyNames, str);
+  const mask = hashSlots - 1;
+
+  return {
+    version,
+    count,
+    liquidity,
+    lastActive,
+    tickSize,
+    lotSize,
+    sectorCode,
+    currencyCode,
+    sectors: sectorList,
+    currencies: currencyList,
+    symbol: (i) => ascii(symbolIds[i]),
+    name: (i) => str(nameIds[i]),
+    sector: (i) => sectorList[sectorCode[i]],
+    currency: (i) => currencyList[currencyCode[i]],
+    // id of a ticker, or -1
+    idOf(sym) {
+      for (let i = hashSymbol(sym) & mask; hash[i]; i = (i + 1) & mask) if (isSymbol(hash[i] - 1, sym)) return hash[i] - 1;
+      return -1;
+    },
+  };
+}
+
+// Same shape as readInstruments(), backed by plain rows – used when the file is unavailable.
+export function instrumentsFromRows(rows) {
+  const dict = (key, fallback) => {
+    const list = [];
+    const codes = Uint8Array.from(rows, (r) => {
+      const v = r[key] || fallback;
+      if (!list.includes(v)) list.push(v);
+      return list.indexOf(v);
+    });
+    return [list, codes];
+  };
+  const [sectors, sectorCode] = dict("sector", "Other");
+  const [currencies, currencyCode] = dict("currency", "USD");
+  const ids = new Map(rows.map((r, i) => [r.sym, i]));
+  return {
+    version: 0,
+    count: rows.length,
+    liquidity: Float32Array.from(rows, (r) => r.liquidity || 0),
+    lastActive: Uint32Array.from(rows, (r) => r.lastActive || 0),
+    tickSize: Float32Array.from(rows, (r) => r.tickSize || 0.01),
+    lotSize: Uint32Array.from(rows, (r) => r.lotSize || 1),
+    sectorCode,
+    currencyCode,
+    sectors,
+    currencies,
+    symbol: (i) => rows[i].sym,
+    name: (i) => rows[i].name,
+    sector: (i) => sectors[sectorCode[i]],
+    currency: (i) => currencies[currencyCode[i]],
+    idOf: (sym) => (ids.has(sym) ? ids.get(sym) : -1),
+  };
+}
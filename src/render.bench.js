@@ -0,0 +1,181 @@
+import React, { Profiler } from 'react';
+import { act, fireEvent, render, screen } from '@testing-library/react';
+import fs from 'fs';
+import path from 'path';
+import v8 from 'v8';
+import FinSight360, { Table } from './App';
+import LineArea from './widgets/LineArea';
+import Donut from './widgets/Donut';
+import CandleStick from './widgets/CandleStick';
+import { appendPoint, fromRows } from './seriesStore';
+import { prefs } from './prefs';
+
+// npm run bench -- render   (not part of `npm test`)
+// Mounts each widget at several data sizes under <Profiler>, drives TICKS simulated price ticks and
+// records per tick: commits, commit duration (Profiler actualDuration) and heap growth (no GC is
+// forced, so it approximates bytes allocated). Results are appended as one JSON line per run to
+// bench-results/render.jsonl (or $BENCH_OUT) so runs can be compared over time.
+//
+// jsdom has no layout, so ResponsiveContainer gets a fixed 800x300 and ApexCharts (imperative SVG
+// outside React's commit) is replaced by a stub that still receives the full series.
+
+jest.mock('recharts', () => {
+  const React = require('react');
+  const actual = jest.requireActual('recharts');
+  return { ...actual, ResponsiveContainer: ({ children }) => React.cloneElement(children, { width: 800, height: 300 }) };
+});
+jest.mock('react-apexcharts', () => ({ series }) => require('react').createElement('div', { 'data-points': series[0].data.length }));
+
+const TICKS = 30;
+const DAY = 86400000;
+const OUT = process.env.BENCH_OUT || path.join(__dirname, '..', 'bench-results', 'render.jsonl');
+const results = [];
+
+let seed = 7;
+const rnd = () => ((seed = (seed * 1664525 + 1013904223) >>> 0) / 2 ** 32);
+const heap = () => v8.getHeapStatistics().used_heap_size;
+const pct = (sorted, q) => (sorted.length ? sorted[Math.max(1, Math.ceil(q * sorted.length)) - 1] : 0);
+const round = (n) => +n.toFixed(3);
+
+// one <Profiler> around the element; tick(i) must cause the update (returns the next element or null)
+async function profile(name, scale, element, tick, { settle = () => {} } = {}) {
+  const commits = [];
+  const wrap = (el) => (
+    <Profiler id={name} onRender={(id, phase, actualDuration) => commits.push({ phase, actualDuration })}>
+      {el}
+    </Profiler>
+  );
+  const view = render(wrap(element));
+  await settle();
+  const mountMs = commits.reduce((s, c) => s + c.actualDuration, 0);
+  const mountCommits = commits.length;
+
+  const perTick = [];
+  const h0 = heap();
+  for (let i = 0; i < TICKS; i++) {
+    const before = commits.length;
+    await act(async () => {
+      const next = tick(i);
+      if (next) view.rerender(wrap(next));
+    });
+    const mine = commits.slice(before);
+    perTick.push({ commits: mine.length, ms: mine.reduce((s, c) => s + c.actualDuration, 0) });
+  }
+  const heapPerTick = (heap() - h0) / TICKS;
+  view.unmount();
+
+  const ms = perTick.map((t) => t.ms).sort((a, b) => a - b);
+  const r = {
+    widget: name,
+    scale,
+    mountMs: round(mountMs),
+    mountCommits,
+    commitsPerTick: round(perTick.reduce((s, t) => s + t.commits, 0) / TICKS),
+    commitMsMean: round(ms.reduce((s, x) => s + x, 0) / TICKS),
+    commitMsP95: round(pct(ms, 0.95)),
+    heapBytesPerTick: Math.round(heapPerTick),
+  };
+  results.push(r);
+  return r;
+}
+
+// ---------- synthetic data
+const quotes = (n) => Array.from({ length: n }, (_, i) => ({ sym: `S${i}`, name: `Company ${i}`, price: 50 + rnd() * 200, delta: (rnd() - 0.5) * 4 }));
+const series = (n) =>
+  fromRows(
+    Array.from({ length: n }, (_, i) => i),
+    (i) => Date.UTC(2024, 0, 1) + i * DAY,
+    ['v'],
+    (i) => [100 + Math.sin(i / 9) * 10 + rnd() * 2]
+  );
+const candles = (n) =>
+  fromRows(
+    Array.from({ length: n }, (_, i) => i),
+    (i) => Date.UTC(2024, 0, 1) + i * DAY,
+    ['o', 'h', 'l', 'c'],
+    (i) => {
+      const o = 100 + Math.sin(i / 7) * 10;
+      const c = o + (rnd() - 0.5) * 4;
+      return [o, Math.max(o, c) + rnd(), Math.min(o, c) - rnd(), c];
+    }
+  );
+const slices = (n) => Array.from({ length: n }, (_, i) => ({ name: `Asset ${i}`, pct: 1 + rnd() * 20 }));
+
+// ---------- widgets
+describe('widget render cost per tick', () => {
+  test.each([100, 1000, 10000])('Table, %i rows', async (n) => {
+    let rows = quotes(n);
+    await profile('Table', n, <Table rows={rows} selected={null} />, () => {
+      rows = rows.map((r) => ({ ...r, price: r.price * (1 + (rnd() - 0.5) * 0.002) }));
+      return <Table rows={rows} selected={null} />;
+    });
+  });
+
+  test.each([30, 365, 2000])('LineArea, %i points', async (n) => {
+    const s = series(n);
+    await profile('LineArea', n, <LineArea id="bench" series={s} />, () => {
+      appendPoint(s, s.t[s.length - 1] + DAY, [100 + rnd() * 10]);
+      return <LineArea id="bench" series={s} />;
+    });
+  });
+
+  test.each([5, 20, 50])('Donut, %i slices', async (n) => {
+    let data = slices(n);
+    await profile('Donut', n, <Donut data={data} />, () => {
+      data = data.map((d) => ({ ...d, pct: Math.max(0.5, d.pct + (rnd() - 0.5)) }));
+      return <Donut data={data} />;
+    });
+  });
+
+  test.each([30, 365, 2000])('CandleStick, %i bars', async (n) => {
+    const s = candles(n);
+    await profile('CandleStick', n, <CandleStick id="bench" series={s} />, () => {
+      const c = s.cols.c[s.length - 1] + (rnd() - 0.5);
+      appendPoint(s, s.t[s.length - 1] + DAY, [c, c + rnd(), c - rnd(), c]);
+      return <CandleStick id="bench" series={s} />;
+    });
+  });
+});
+
+// ---------- the whole dashboard
+// Logs in through the form, lets history loads and lazy chunks settle, then advances the feed's
+// main-thread walk (jsdom has no Worker) one push per tick; the role sets how many widgets mount.
+describe('dashboard grid', () => {
+  beforeEach(() => {
+    jest.useFakeTimers();
+    sessionStorage.clear(); // each role logs in through the form
+  });
+  afterEach(() => jest.useRealTimers());
+
+  const settle = async () => {
+    for (let i = 0; i < 10; i++) {
+      await act(async () => {
+        jest.advanceTimersByTime(250);
+      });
+    }
+  };
+
+  test.each(['Viewer', 'Analyst', 'Admin'])('FinSight360, %s', async (role) => {
+    prefs.set('fs:role', role);
+    const login = async () => {
+      const [user, pass] = screen.getAllByPlaceholderText('admin');
+      fireEvent.change(user, { target: { value: 'admin' } });
+      fireEvent.change(pass, { target: { value: 'admin' } });
+      fireEvent.submit(user.closest('form'));
+      await act(async () => {
+        jest.advanceTimersByTime(1200);
+      });
+      await settle();
+    };
+    const r = await profile('FinSight360', role, <FinSight360 />, () => jest.advanceTimersByTime(1000 + 16), { settle: login });
+    expect(screen.getByText('Top Stocks')).toBeInTheDocument();
+    expect(r.commitsPerTick).toBeGreaterThan(0);
+  });
+});
+
+afterAll(() => {
+  const run = { ts: new Date().toISOString(), node: process.version, ticks: TICKS, results };
+  fs.mkdirSync(path.dirname(OUT), { recursive: true });
+  fs.appendFileSync(OUT, `${JSON.stringify(run)}\n`);
+  console.log(JSON.stringify({ bench: 'render', out: OUT, results }, null, 2));
+});
@@ -0,0 +1,173 @@
+import { useSyncExternalStore } from "react";
+
+/**
+ * Render-quality governor
+ * - Samples frame durations (rAF deltas) and long tasks (PerformanceObserver)
+ * - Steps down one quality level per evaluation window while the main thread is janky
+ * - Steps back up only after several clean windows *and* an idle callback with real slack; without
+ *   requestIdleCallback (Safari) the clean windows alone decide
+ * - Widgets read the current level via useRenderQuality() (re-render only on level change)
+ */
+
+// higher index = cheaper rendering
+export const QUALITY_LEVELS = [
+  { level: 0, name: "Full", layoutAnimations: true, chartAnimations: true, minUpdateMs: 0, detail: "full" },
+  { level: 1, name: "Balanced", layoutAnimations: false, chartAnimations: true, minUpdateMs: 0, detail: "full" },
+  { level: 2, name: "Reduced", layoutAnimations: false, chartAnimations: false, minUpdateMs: 2000, detail: "full" },
+  { level: 3, name: "Low", layoutAnimations: false, chartAnimations: false, minUpdateMs: 4000, detail: "low" },
+];
+
+const DEFAULTS = {
+  frameBudgetMs: 1000 / 60,
+  windowMs: 1000, // evaluation window
+  jankFactor: 1.5, // a frame is janky above budget * jankFactor
+  downJankRatio: 0.25, // step down when >25% of frames in a window are janky…
+  downLongTaskMs: 100, // …or long tasks blocked the thread for >100ms in the window
+  upCleanWindows: 3, // consecutive clean windows before stepping up
+  upJankRatio: 0.05,
+  idleSlackMs: 10, // requestIdleCallback must report at least this much slack
+  cooldownMs: 2000, // minimum time between two level changes
+};
+
+export function createRenderGovernor(opts = {}) {
+  const cfg = { ...DEFAULTS, ...opts };
+  const listeners = new Set();
+  let level = 0;
+  let lastChange = 0;
+  let cleanWindows = 0;
+  let running = false;
+  let raf = 0;
+  let idleId = 0;
+  let observer = null;
+  // current window accumulators
+  let lastFrame = 0;
+  let windowStart = 0;
+  let frames = 0;
+  let janky = 0;
+  let longTaskMs = 0;
+  let longTasks = 0;
+  let stats = { fps: 0, jankRatio: 0, longTaskMs: 0, longTasks: 0 };
+
+  const emit = () => listeners.forEach((l) => l());
+
+  const setLevel = (next, now) => {
+    next = Math.max(0, Math.min(QUALITY_LEVELS.length - 1, next));
+    if (next === level) return;
+    level = next;
+    lastChange = now;
+    cleanWindows = 0;
+    emit();
+  };
+
+  const hasIdle = () => typeof requestIdleCallback === "function";
+
+  // only step up if the browser hands us a genuinely idle slice
+  const tryStepUp = () => {
+    if (!hasIdle()) {
+      setLevel(level - 1, performance.now());
+      return;
+    }
+    if (idleId) return;
+    idleId = requestIdleCallback((deadline) => {
+      idleId = 0;
+      if (!running || level === 0) return;
+      if (deadline.timeRemaining() >= cfg.idleSlackMs) setLevel(level - 1, performance.now());
+    }, { timeout: cfg.windowMs });
+  };
+
+  const evaluate = (now) => {
+    const elapsed = now - windowStart;
+    const jankRatio = frames ? janky / frames : 0;
+    stats = { fps: Math.round((frames * 1000) / elapsed), jankRatio, longTaskMs, longTasks };
+    if (now - lastChange >= cfg.cooldownMs) {
+      if (jankRatio > cfg.downJankRatio || longTaskMs > cfg.downLongTaskMs) {
+        setLevel(level + 1, now);
+      } else if (jankRatio <= cfg.upJankRatio && longTaskMs === 0) {
+        if (++cleanWindows >= cfg.upCleanWindows) {
+          cleanWindows = 0;
+          tryStepUp();
+        }
+      } else {
+        cleanWindows = 0;
+      }
+    }
+    windowStart = now;
+    frames = janky = longTaskMs = longTasks = 0;
+  };
+
+  const onFrame = (now) => {
+    if (!running) return;
+    if (lastFrame) {
+      frames++;
+      if (now - lastFrame > cfg.frameBudgetMs * cfg.jankFactor) janky++;
+    }
+    lastFrame = now;
+    if (now - windowStart >= cfg.windowMs) evaluate(now);
+    raf = requestAnimationFrame(onFrame);
+  };
+
+  // background tabs throttle rAF to ~1Hz, which would read as jank
+  const onVisibility = () => {
+    if (document.visibilityState === "hidden") {
+      cancelAnimationFrame(raf);
+      raf = 0;
+    } else if (running && !raf) {
+      lastFrame = 0;
+      windowStart = performance.now();
+      frames = janky = longTaskMs = longTasks = 0;
+      raf = requestAnimationFrame(onFrame);
+    }
+  };
+
+  const start = () => {
+    if (running) return;
+    running = true;
+    windowStart = lastChange = performance.now();
+    lastFrame = 0;
+    if (typeof PerformanceObserver === "function" && (PerformanceObserver.supportedEntryTypes || []).includes("longtask")) {
+      observer = new PerformanceObserver((list) => {
+        list.getEntries().forEach((e) => {
+          longTaskMs += e.duration;
+          longTasks++;
+        });
+      });
+      observer.observe({ type: "longtask", buffered: false });
+    }
+    document.addEventListener("visibilitychange", onVisibility);
+    raf = requestAnimationFrame(onFrame);
+  };
+
+  const stop = () => {
+    running = false;
+    cancelAnimationFrame(raf);
+    raf = 0;
+    if (idleId) cancelIdleCallback(idleId);
+    idleId = 0;
+    if (observer) observer.disconnect();
+    observer = null;
+    document.removeEventListener("visibilitychange", onVisibility);
+  };
+
+  return {
+    // sampling runs only while someone is subscribed
+    subscribe(listener) {
+      listeners.add(listener);
+      if (listeners.size === 1) start();
+      return () => {
+        listeners.delete(listener);
+        if (listeners.size === 0) stop();
+      };
+    },
+    getQuality: () => QUALITY_LEVELS[level],
+    getStats: () => stats,
+    setLevel: (next) => setLevel(next, performance.now()),
+  };
+}
+
+// ---------- shared instance + hook
+export const renderGovernor = createRenderGovernor();
+const getServerQuality = () => QUALITY_LEVELS[0];
+
+export function useRenderQuality() {
+  return useSyncExternalStore(renderGovernor.subscribe, renderGovernor.getQuality, getServerQuality);
+}
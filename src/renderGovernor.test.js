@@ -0,0 +1,81 @@
+import { createRenderGovernor } from './renderGovernor';
+
+// rAF, the clock and requestIdleCallback driven by hand; 16ms frames are clean
+const setup = ({ idleMs } = {}) => {
+  let t = 0;
+  let frame = null;
+  let idle = null;
+  jest.spyOn(performance, 'now').mockImplementation(() => t);
+  global.requestAnimationFrame = (cb) => {
+    frame = cb;
+    return 1;
+  };
+  global.cancelAnimationFrame = () => {};
+  if (idleMs !== undefined) {
+    global.requestIdleCallback = (cb) => {
+      idle = cb;
+      return 1;
+    };
+    global.cancelIdleCallback = () => {};
+  }
+  const frames = (n, ms = 16) => {
+    for (let i = 0; i < n; i++) {
+      t += ms;
+      frame(t);
+    }
+  };
+  const runIdle = () => idle && idle({ timeRemaining: () => idleMs });
+  return { frames, runIdle };
+};
+
+const make = () => createRenderGovernor({ windowMs: 160, cooldownMs: 0, upCleanWindows: 2 });
+
+afterEach(() => {
+  jest.restoreAllMocks();
+  delete global.requestIdleCallback;
+  delete global.cancelIdleCallback;
+});
+
+test('steps down on janky frames', () => {
+  const { frames } = setup();
+  const gov = make();
+  const stop = gov.subscribe(() => {});
+  frames(4, 50); // one window
+  expect(gov.getQuality().level).toBe(1);
+  stop();
+});
+
+test('without requestIdleCallback, clean windows alone step back up', () => {
+  const { frames } = setup();
+  const gov = make();
+  const stop = gov.subscribe(() => {});
+  gov.setLevel(2);
+  frames(10); // first clean window
+  expect(gov.getQuality().level).toBe(2);
+  frames(10);
+  expect(gov.getQuality().level).toBe(1);
+  frames(20);
+  expect(gov.getQuality().level).toBe(0);
+  stop();
+});
+
+test('with requestIdleCallback, stepping up waits for real idle slack', () => {
+  const busy = setup({ idleMs: 0 });
+  let gov = make();
+  let stop = gov.subscribe(() => {});
+  gov.setLevel(2);
+  busy.frames(20);
+  busy.runIdle();
+  expect(gov.getQuality().level).toBe(2);
+  stop();
+
+  const idle = setup({ idleMs: 12 });
+  gov = make();
+  stop = gov.subscribe(() => {});
+  gov.setLevel(2);
+  idle.frames(20);
+  expect(gov.getQuality().level).toBe(2);
+  idle.runIdle();
+  expect(gov.getQuality().level).toBe(1);
+  stop();
+});
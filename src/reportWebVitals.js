@@ -1,3 +1,5 @@
+import { observeINP } from './vitals';
+
 const reportWebVitals = onPerfEntry => {
   if (onPerfEntry && onPerfEntry instanceof Function) {
     import('web-vitals').then(({ getCLS, getFID, getFCP, getLCP, getTTFB }) => {
@@ -7,6 +9,8 @@ const reportWebVitals = onPerfEntry => {
       getLCP(onPerfEntry);
       getTTFB(onPerfEntry);
     });
+    // web-vitals 2.x has no INP
+    observeINP(onPerfEntry);
   }
 };
 
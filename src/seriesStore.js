@@ -0,0 +1,82 @@
+/**
+ * Columnar time series
+ * - t: Float64Array of epoch-ms timestamps (ascending), one Float64Array per field
+ * - Capacity doubles on append; `length` is the number of valid points
+ * - `version` bumps on every mutation so memoized views can key off it
+ */
+
+export function createSeries(fields, capacity = 256) {
+  const cols = {};
+  fields.forEach((f) => (cols[f] = new Float64Array(capacity)));
+  return { fields, t: new Float64Array(capacity), cols, length: 0, version: 0 };
+}
+
+const grow = (s, min) => {
+  let cap = s.t.length || 1;
+  while (cap < min) cap *= 2;
+  const t = new Float64Array(cap);
+  t.set(s.t.subarray(0, s.length));
+  s.t = t;
+  s.fields.forEach((f) => {
+    const c = new Float64Array(cap);
+    c.set(s.cols[f].subarray(0, s.length));
+    s.cols[f] = c;
+  });
+};
+
+// room for at least `min` points, for bulk writers that fill the columns directly
+export function reserve(s, min) {
+  if (s.t.length < min) grow(s, min);
+  return s;
+}
+
+// values: array in `fields` order
+export function appendPoint(s, t, values) {
+  if (s.length === s.t.length) grow(s, s.length + 1);
+  const i = s.length++;
+  s.t[i] = t;
+  s.fields.forEach((f, k) => (s.cols[f][i] = values[k]));
+  s.version++;
+  return s;
+}
+
+export function fromRows(rows, tOf, fields, valuesOf) {
+  const s = createSeries(fields, Math.max(1, rows.length));
+  rows.forEach((r) => appendPoint(s, tOf(r), valuesOf(r)));
+  return s;
+}
+
+// first index with t[i] >= x (length if none)
+export function lowerBound(ts, length, x) {
+  let lo = 0;
+  let hi = length;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (ts[mid] < x) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+export function nearestIndex(s, x) {
+  if (!s.length) return -1;
+  const i = lowerBound(s.t, s.length, x);
+  if (i === 0) return 0;
+  if (i === s.length) return s.length - 1;
+  return x - s.t[i - 1] <= s.t[i] - x ? i - 1 : i;
+}
+
+// Row objects for chart libraries, strided down to at most maxPoints (last point kept).
+export function toRows(s, maxPoints = Infinity) {
+  const step = Math.max(1, Math.ceil(s.length / maxPoints));
+  const rows = [];
+  for (let i = 0; i < s.length; i += step) rows.push(rowAt(s, i));
+  if (s.length && (s.length - 1) % step) rows.push(rowAt(s, s.length - 1));
+  return rows;
+}
+
+export function rowAt(s, i) {
+  const row = { t: s.t[i] };
+  s.fields.forEach((f) => (row[f] = s.cols[f][i]));
+  return row;
+}
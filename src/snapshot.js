@@ -0,0 +1,234 @@
+/**
+ * Binary last-known-state snapshot (warmStart.js writes one periodically and restores it on load)
+ *   header  u32 magic "FSWS" | u16 VERSION | u16 sections | f64 savedAt (epoch ms)
+ *   section u8 kind | u32 body bytes | body, padded to 8 bytes
+ *     PRICES   u32 n, n × (str sym, f64 price)
+ *     SERIES   str key, u8 fields, fields × str, u32 length, f64[length] t, fields × f64[length]
+ *     ENTITIES u32-length UTF-8 JSON of an entityStore payload ({ [type]: [entity] })
+ * - str is a u16 length plus UTF-8; f64 arrays start 8-byte aligned, so decode returns
+ *   Float64Array views over the buffer instead of copies
+ * - Unknown section kinds are skipped; a different VERSION or a bad magic decodes to null
+ */
+
+export const VERSION = 1;
+export const SNAPSHOT_KEY = "warm-start"; // in idb.js's "cache" store
+const MAGIC = 0x46535753;
+const PRICES = 1;
+const SERIES = 2;
+const ENTITIES = 3;
+
+const utf8 = new TextEncoder();
+const text = new TextDecoder();
+const pad8 = (n) => (n + 7) & ~7;
+
+function createWriter(size = 4096) {
+  let buf = new ArrayBuffer(size);
+  let view = new DataView(buf);
+  let off = 0;
+  const room = (n) => {
+    if (off + n <= buf.byteLength) return;
+    let cap = buf.byteLength * 2;
+    while (cap < off + n) cap *= 2;
+    const next = new ArrayBuffer(cap);
+    new Uint8Array(next).set(new Uint8Array(buf, 0, off));
+    buf = next;
+    view = new DataView(buf);
+  };
+  const w = {
+    get offset() {
+      return off;
+    },
+    u8(v) {
+      room(1);
+      view.setUint8(off, v);
+      off += 1;
+    },
+    u16(v) {
+      room(2);
+      view.setUint16(off, v, true);
+      off += 2;
+    },
+    u32(v) {
+      room(4);
+      view.setUint32(off, v, true);
+      off += 4;
+    },
+    u32At: (at, v) => view.setUint32(at, v, true),
+    f64(v) {
+      room(8);
+      view.setFloat64(off, v, true);
+      off += 8;
+    },
+    bytes(b) {
+      room(b.length);
+      new Uint8Array(buf, off, b.length).set(b);
+      off += b.length;
+    },
+    str(s) {
+      const b = utf8.encode(s);
+      w.u16(b.length);
+      w.bytes(b);
+    },
+    align() {
+      const to = pad8(off);
+      room(to - off);
+      new Uint8Array(buf, off, to - off).fill(0);
+      off = to;
+    },
+    f64s(arr, n) {
+      w.align();
+      w.bytes(new Uint8Array(arr.buffer, arr.byteOffset, n * 8));
+    },
+    done: () => buf.slice(0, off),
+  };
+  return w;
+}
+
+// { savedAt, prices: { [sym]: number }, series: { [key]: seriesStore series }, entities }
+export function encodeSnapshot({ savedAt = Date.now(), prices = {}, series = {}, entities = null }) {
+  const w = createWriter();
+  w.u32(MAGIC);
+  w.u16(VERSION);
+  const keys = Object.keys(series);
+  w.u16(1 + keys.length + (entities ? 1 : 0));
+  w.f64(savedAt);
+  const section = (kind, body) => {
+    w.u8(kind);
+    const at = w.offset;
+    w.u32(0);
+    w.align(); // bodies start aligned, so their f64 arrays can be too
+    const start = w.offset;
+    body();
+    w.align();
+    w.u32At(at, w.offset - start);
+  };
+
+  const syms = Object.keys(prices);
+  section(PRICES, () => {
+    w.u32(syms.length);
+    syms.forEach((s) => {
+      w.str(s);
+      w.f64(prices[s]);
+    });
+  });
+  keys.forEach((key) =>
+    section(SERIES, () => {
+      const s = series[key];
+      w.str(key);
+      w.u8(s.fields.length);
+      s.fields.forEach(w.str);
+      w.u32(s.length);
+      w.f64s(s.t, s.length);
+      s.fields.forEach((f) => w.f64s(s.cols[f], s.length));
+    })
+  );
+  if (entities) {
+    section(ENTITIES, () => {
+      const b = utf8.encode(JSON.stringify(entities));
+      w.u32(b.length);
+      w.bytes(b);
+    });
+  }
+  return w.done();
+}
+
+/**
+ * encodeSnapshot({ savedAt, series: { [key]: s } }) as a sequence of chunks: the header and
+ * section prefix first, then each column `chunkRows` points at a time (copied, so the series may
+ * keep growing meanwhile). The file export streams a long series this way without one buffer
+ * holding it all; decodeSnapshot reads the result like any snapshot.
+ */
+export function* encodeSeriesChunks(key, s, { savedAt = Date.now(), chunkRows = 1 << 16 } = {}) {
+  const n = s.length;
+  const w = createWriter(256);
+  w.u32(MAGIC);
+  w.u16(VERSION);
+  w.u16(2);
+  w.f64(savedAt);
+  // an empty PRICES section, as encodeSnapshot always writes one
+  w.u8(PRICES);
+  w.u32(8);
+  w.align();
+  w.u32(0);
+  w.align();
+  w.u8(SERIES);
+  const at = w.offset;
+  w.u32(0);
+  w.align();
+  const start = w.offset;
+  w.str(key);
+  w.u8(s.fields.length);
+  s.fields.forEach(w.str);
+  w.u32(n);
+  w.align();
+  w.u32At(at, w.offset - start + (1 + s.fields.length) * n * 8);
+  yield new Uint8Array(w.done());
+  for (const col of [s.t, ...s.fields.map((f) => s.cols[f])]) {
+    for (let i = 0; i < n; i += chunkRows) {
+      const part = col.slice(i, Math.min(n, i + chunkRows));
+      yield new Uint8Array(part.buffer);
+    }
+  }
+}
+
+export function decodeSnapshot(buf) {
+  if (!(buf instanceof ArrayBuffer) || buf.byteLength < 16) return null;
+  const view = new DataView(buf);
+  if (view.getUint32(0, true) !== MAGIC || view.getUint16(4, true) !== VERSION) return null;
+  const count = view.getUint16(6, true);
+  const out = { savedAt: view.getFloat64(8, true), prices: {}, series: {}, entities: null };
+  let off = 16;
+  const str = () => {
+    const n = view.getUint16(off, true);
+    const s = text.decode(new Uint8Array(buf, off + 2, n));
+    off += 2 + n;
+    return s;
+  };
+  const f64s = (n) => {
+    off = pad8(off);
+    const a = new Float64Array(buf, off, n);
+    off += n * 8;
+    return a;
+  };
+
+  const readSection = (kind) => {
+    if (kind === PRICES) {
+      const n = view.getUint32(off, true);
+      off += 4;
+      for (let k = 0; k < n; k++) {
+        const sym = str();
+        out.prices[sym] = view.getFloat64(off, true);
+        off += 8;
+      }
+    } else if (kind === SERIES) {
+      const key = str();
+      const fields = [];
+      for (let k = view.getUint8(off++); k > 0; k--) fields.push(str());
+      const length = view.getUint32(off, true);
+      off += 4;
+      const t = f64s(length);
+      const cols = {};
+      fields.forEach((f) => (cols[f] = f64s(length)));
+      out.series[key] = { fields, t, cols, length, version: 0 };
+    } else if (kind === ENTITIES) {
+      const n = view.getUint32(off, true);
+      out.entities = JSON.parse(text.decode(new Uint8Array(buf, off + 4, n)));
+    }
+  };
+
+  // a truncated or damaged buffer reads out of bounds (RangeError) or into bad JSON: not a snapshot
+  try {
+    for (let i = 0; i < count; i++) {
+      const kind = view.getUint8(off);
+      const len = view.getUint32(off + 1, true);
+      const start = pad8(off + 5);
+      if (start + len > buf.byteLength) return null;
+      off = start;
+      readSection(kind);
+      off = start + len;
+    }
+  } catch (e) {
+    return null;
+  }
+  return out;
+}
@@ -0,0 +1,51 @@
+import { decodeSnapshot, encodeSeriesChunks, encodeSnapshot } from './snapshot';
+import { appendPoint, fromRows } from './seriesStore';
+
+const candles = fromRows([1, 2, 3], (i) => i * 1000, ['o', 'h', 'l', 'c'], (i) => [i, i + 1, i - 1, i + 0.5]);
+
+test('round-trips prices, series and entities, with series columns as views over the buffer', () => {
+  const entities = { account: [{ id: 'main', positions: ['p1'] }], position: [{ id: 'p1', sym: 'AAPL', pct: 45 }] };
+  const buf = encodeSnapshot({ savedAt: 1234, prices: { AAPL: 191.25, 'BTC-€': 60000.5 }, series: { 'history:candles': candles }, entities });
+  const snap = decodeSnapshot(buf);
+  expect(snap.savedAt).toBe(1234);
+  expect(snap.prices).toEqual({ AAPL: 191.25, 'BTC-€': 60000.5 });
+  expect(snap.entities).toEqual(entities);
+  const s = snap.series['history:candles'];
+  expect(s.fields).toEqual(['o', 'h', 'l', 'c']);
+  expect(s.length).toBe(3);
+  expect(Array.from(s.t)).toEqual([1000, 2000, 3000]);
+  expect(Array.from(s.cols.c)).toEqual([1.5, 2.5, 3.5]);
+  expect(s.t.buffer).toBe(buf);
+  // still an ordinary series: appending grows it off the snapshot buffer
+  appendPoint(s, 4000, [4, 5, 3, 4.5]);
+  expect(s.length).toBe(4);
+  expect(s.t.buffer === buf).toBe(false);
+});
+
+test('a foreign or truncated buffer is not a snapshot', () => {
+  expect(decodeSnapshot(new ArrayBuffer(32))).toBeNull();
+  expect(decodeSnapshot(undefined)).toBeNull();
+  const buf = encodeSnapshot({ prices: { A: 1 } });
+  new DataView(buf).setUint16(4, 99, true);
+  expect(decodeSnapshot(buf)).toBeNull();
+  // cut anywhere past the header, or with a section length pointing past the end
+  const full = encodeSnapshot({ prices: { A: 1 }, series: { 'history:candles': candles }, entities: { account: [] } });
+  for (let n = 16; n < full.byteLength; n += 4) expect(decodeSnapshot(full.slice(0, n))).toBeNull();
+  const bad = full.slice(0);
+  new DataView(bad).setUint32(17, 1 << 30, true);
+  expect(decodeSnapshot(bad)).toBeNull();
+});
+
+test('chunked series encoding is byte-for-byte the snapshot encoding', () => {
+  const chunks = [...encodeSeriesChunks('history:candles', candles, { savedAt: 99, chunkRows: 2 })];
+  expect(chunks.length).toBe(1 + 5 * 2); // prefix, then t/o/h/l/c in two slices each
+  const joined = new Uint8Array(chunks.reduce((n, c) => n + c.length, 0));
+  let off = 0;
+  chunks.forEach((c) => {
+    joined.set(c, off);
+    off += c.length;
+  });
+  const whole = new Uint8Array(encodeSnapshot({ savedAt: 99, series: { 'history:candles': candles } }));
+  expect(Array.from(joined)).toEqual(Array.from(whole));
+  expect(Array.from(decodeSnapshot(joined.buffer).series['history:candles'].cols.h)).toEqual([2, 3, 4]);
+});
@@ -0,0 +1,37 @@
+/* eslint-disable no-restricted-globals */
+import { encodeSnapshot, SNAPSHOT_KEY } from "./snapshot";
+import { idbPut } from "./idb";
+
+/**
+ * Snapshot writer for warmStart.js: the binary encode and the IndexedDB write, off the main thread
+ *   in:  { type: "save", state: { savedAt, prices, series, entities } }
+ *   out: { type: "saved", bytes } | { type: "error", message }
+ * Saves arriving while a write is in flight are coalesced: only the newest one is written next.
+ */
+
+let writing = false;
+let next = null;
+
+function write(state) {
+  writing = true;
+  const buf = encodeSnapshot(state);
+  idbPut("cache", SNAPSHOT_KEY, buf)
+    .then(
+      () => self.postMessage({ type: "saved", bytes: buf.byteLength }),
+      (e) => self.postMessage({ type: "error", message: e.message })
+    )
+    .then(() => {
+      writing = false;
+      if (next) {
+        const state = next;
+        next = null;
+        write(state);
+      }
+    });
+}
+
+self.onmessage = ({ data }) => {
+  if (data.type !== "save") return;
+  if (writing) next = data.state;
+  else write(data.state);
+};
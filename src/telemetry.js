@@ -0,0 +1,142 @@
+import { useSyncExternalStore } from "react";
+import { createHistogram } from "./histogram";
+import { fetchCache } from "./fetchCache";
+
+/**
+ * System Health telemetry: one 1 Hz sample of client and gateway metrics
+ * - Client side: API round trips (µs histogram), ticks received and superseded by the feed
+ *   worker and by the rAF / governor commit path, prices changed per React commit, cache hit ratio
+ * - Gateway side (when REACT_APP_GATEWAY_URL is set): its {"t":"m"} frame – connected clients,
+ *   fan-out latency p50/p99/p999, dropped clients – forwarded by feed.worker.js
+ * - Sampling runs only while someone subscribes; onActive() tells the feed to switch the
+ *   worker's latency recording and the gateway's metrics push on and off with it
+ * - Each metric keeps the last HISTORY samples for the card's sparklines
+ */
+
+export const HISTORY = 60;
+const SERIES = ["api", "feed", "fanout", "rate", "conflated", "hitRatio", "users"];
+
+export function createTelemetry({ interval = 1000, now = () => Date.now(), cacheStats = () => fetchCache.stats() } = {}) {
+  const api = createHistogram();
+  const listeners = new Set();
+  const activeListeners = new Set();
+  let ticks = 0;
+  let conflated = 0;
+  let rendered = 0;
+  let feedLat = null;
+  let gateway = null;
+  let ws = "mock";
+  let last = now();
+  let timer = 0;
+  let snap = {
+    ws,
+    users: null,
+    api: null,
+    feed: null,
+    fanout: null,
+    rate: 0,
+    conflated: 0,
+    rendered: 0,
+    dropped: 0,
+    hitRatio: null,
+    series: Object.fromEntries(SERIES.map((k) => [k, []])),
+  };
+
+  const active = () => listeners.size > 0;
+  const push = (arr, v) => (arr.length >= HISTORY ? arr.slice(1 - HISTORY) : arr.slice()).concat(v);
+
+  const t = {
+    // latency in µs for a named client-side stage (only "api" today)
+    record(name, us) {
+      if (name === "api" && active()) api.record(us);
+    },
+    // per-push stats from feed.worker.js: { ticks, conflated, lat: [p50, p99, p999] | null }
+    feed(stats) {
+      ticks += stats.ticks;
+      conflated += stats.conflated;
+      if (stats.lat) feedLat = stats.lat;
+    },
+    // ticks superseded on the main thread (rAF replaced, or held back by the render governor)
+    conflate(n = 1) {
+      if (active()) conflated += n;
+    },
+    // prices that changed in a usePriceFeed commit
+    rendered(n) {
+      if (active()) rendered += n;
+    },
+    gatewayMetrics(m) {
+      gateway = m;
+    },
+    // "mock" | "connecting" | "open" | "closed"
+    connection(state) {
+      ws = state;
+      if (state !== "open") gateway = null;
+    },
+    sample() {
+      const at = now();
+      const secs = Math.max(at - last, 1) / 1000;
+      last = at;
+      const apiLat = api.summary();
+      api.reset();
+      const cache = cacheStats();
+      const next = {
+        ws,
+        users: gateway ? gateway.n : null,
+        api: apiLat || snap.api,
+        feed: feedLat,
+        fanout: gateway ? gateway.lat : null,
+        rate: Math.round(ticks / secs),
+        conflated: Math.round(conflated / secs),
+        rendered: Math.round(rendered / secs),
+        dropped: gateway ? gateway.dr : 0,
+        hitRatio: cache.hitRatio,
+      };
+      const value = {
+        api: apiLat ? apiLat[1] : null,
+        feed: feedLat ? feedLat[1] : null,
+        fanout: next.fanout ? next.fanout[1] : null,
+        rate: next.rate,
+        conflated: next.conflated,
+        hitRatio: next.hitRatio,
+        users: next.users,
+      };
+      next.series = Object.fromEntries(SERIES.map((k) => [k, push(snap.series[k], value[k])]));
+      ticks = 0;
+      conflated = 0;
+      rendered = 0;
+      feedLat = null;
+      snap = next;
+      listeners.forEach((l) => l());
+      return snap;
+    },
+    onActive(fn) {
+      activeListeners.add(fn);
+      return () => activeListeners.delete(fn);
+    },
+    subscribe(listener) {
+      listeners.add(listener);
+      if (listeners.size === 1) {
+        last = now();
+        ticks = 0;
+        conflated = 0;
+        rendered = 0;
+        timer = setInterval(t.sample, interval);
+        activeListeners.forEach((fn) => fn(true));
+      }
+      return () => {
+        listeners.delete(listener);
+        if (listeners.size || !timer) return;
+        clearInterval(timer);
+        timer = 0;
+        activeListeners.forEach((fn) => fn(false));
+      };
+    },
+    getSnapshot: () => snap,
+    active,
+  };
+  return t;
+}
+
+export const telemetry = createTelemetry();
+
+export const useTelemetry = () => useSyncExternalStore(telemetry.subscribe, telemetry.getSnapshot);
@@ -0,0 +1,53 @@
+import { createTelemetry, HISTORY } from './telemetry';
+
+const make = () => {
+  let t = 0;
+  const tel = createTelemetry({ now: () => t, cacheStats: () => ({ hitRatio: 0.5 }), interval: 1e9 });
+  return { tel, advance: (ms) => (t += ms) };
+};
+
+test('samples rates, latencies and gateway metrics once per interval', () => {
+  const { tel, advance } = make();
+  const stop = tel.subscribe(() => {});
+  tel.record('api', 120000);
+  tel.feed({ ticks: 800, conflated: 700, lat: [900, 4000, 9000] });
+  tel.conflate(100);
+  tel.rendered(12);
+  tel.connection('open');
+  tel.gatewayMetrics({ n: 42, lat: [300, 1200, 2500], dr: 1 });
+  advance(2000);
+  const s = tel.sample();
+  expect(s).toMatchObject({ ws: 'open', users: 42, rate: 400, conflated: 400, rendered: 6, dropped: 1, hitRatio: 0.5, feed: [900, 4000, 9000], fanout: [300, 1200, 2500] });
+  expect(s.api[1]).toBeGreaterThanOrEqual(120000);
+  expect(s.series.users).toEqual([42]);
+  // counters reset; the last API latency is kept until new round trips arrive
+  advance(1000);
+  const next = tel.sample();
+  expect(next.rate).toBe(0);
+  expect(next.api).toEqual(s.api);
+  expect(next.series.api).toEqual([s.api[1], null]);
+  tel.connection('closed');
+  expect(tel.sample().users).toBeNull();
+  stop();
+});
+
+test('sparklines keep the last HISTORY samples and hidden telemetry records nothing', () => {
+  const { tel, advance } = make();
+  const seen = [];
+  tel.onActive((on) => seen.push(on));
+  tel.record('api', 5000);
+  tel.conflate(3);
+  const stop = tel.subscribe(() => {});
+  advance(1000);
+  expect(tel.sample()).toMatchObject({ api: null, conflated: 0 });
+  for (let i = 0; i < HISTORY + 5; i++) {
+    tel.feed({ ticks: i, conflated: 0, lat: null });
+    advance(1000);
+    tel.sample();
+  }
+  const rate = tel.getSnapshot().series.rate;
+  expect(rate.length).toBe(HISTORY);
+  expect(rate[HISTORY - 1]).toBe(HISTORY + 4);
+  stop();
+  expect(seen).toEqual([true, false]);
+});
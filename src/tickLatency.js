@@ -0,0 +1,103 @@
+import { createHistogram } from "./histogram";
+
+/**
+ * Tick-to-paint latency, one histogram (µs) per stage
+ *   network     gateway ingest (the tick's `us` stamp) -> feed worker receive; gateway mode only
+ *   decode      JSON.parse + alert book for one message, in the worker
+ *   conflation  worker receive -> the PUSH_MS batch that carries the symbol's latest price
+ *   commit      worker post -> React commit of usePriceFeed (postMessage, rAF, governor throttle, render)
+ *   paint       that commit -> the next animation frame
+ *   total       tick origin -> that frame, per symbol shown (how stale a painted price is)
+ * - The worker keeps the first three and posts them as sparse dumps with each push
+ * - Off unless the debug overlay (?latency) is open or REACT_APP_LATENCY_BEACON is set; onEnabled()
+ *   tells the feed worker to start or stop stamping
+ * - The beacon posts the histograms recorded since the last one every beaconMs and on pagehide;
+ *   scripts/beacon-collector.js merges them across clients
+ */
+
+export const STAGES = ["network", "decode", "conflation", "commit", "paint", "total"];
+export const WORKER_STAGES = ["network", "decode", "conflation"];
+
+// µs since the epoch, comparable between the page and its workers
+export const epochUs = () => (performance.timeOrigin + performance.now()) * 1000;
+
+const CLIENT = Math.random().toString(36).slice(2, 10);
+
+export function createTickLatency({
+  now = epochUs,
+  raf = (cb) => requestAnimationFrame(cb),
+  beacon = "",
+  beaconMs = 10000,
+  send = (url, body) => navigator.sendBeacon(url, body),
+} = {}) {
+  const hist = Object.fromEntries(STAGES.map((s) => [s, createHistogram()]));
+  const sinceBeacon = Object.fromEntries(STAGES.map((s) => [s, createHistogram()])); // what the next beacon sends
+  const reasons = new Set();
+  const enabledListeners = new Set();
+  let pending = null; // the newest worker push: { pushed, origins, committed }
+  let timer = 0;
+
+  const rec = (stage, us) => {
+    hist[stage].record(us);
+    if (beacon) sinceBeacon[stage].record(us);
+  };
+  const merge = (stage, dump) => {
+    hist[stage].merge(dump);
+    if (beacon) sinceBeacon[stage].merge(dump);
+  };
+
+  const t = {
+    enabled: () => reasons.size > 0,
+    // reason: "overlay" | "beacon"
+    enable(reason, on) {
+      const was = t.enabled();
+      if (on) reasons.add(reason);
+      else reasons.delete(reason);
+      if (was !== t.enabled()) enabledListeners.forEach((fn) => fn(!was));
+    },
+    onEnabled(fn) {
+      enabledListeners.add(fn);
+      return () => enabledListeners.delete(fn);
+    },
+    // from feed.worker.js: { pushed, origins: [µs per symbol that changed], stages: { network, decode, conflation } }
+    pushed(trace) {
+      if (!t.enabled()) return;
+      WORKER_STAGES.forEach((s) => trace.stages[s] && merge(s, trace.stages[s]));
+      pending = { pushed: trace.pushed, origins: trace.origins, committed: 0 };
+    },
+    // usePriceFeed committed the newest pushed prices; the frame after it paints them
+    committed() {
+      const p = pending;
+      if (!p || p.committed) return;
+      p.committed = now();
+      rec("commit", p.committed - p.pushed);
+      raf(() => {
+        const painted = now();
+        rec("paint", painted - p.committed);
+        p.origins.forEach((o) => rec("total", painted - o));
+        if (pending === p) pending = null;
+      });
+    },
+    // [{ stage, n, lat: [p50, p99, p999] | null, max }] since enable or reset
+    snapshot: () => STAGES.map((s) => ({ stage: s, n: hist[s].count(), lat: hist[s].summary(), max: hist[s].max() })),
+    reset() {
+      STAGES.forEach((s) => hist[s].reset());
+    },
+    flush() {
+      if (!beacon || !sinceBeacon.total.count()) return false;
+      const stages = Object.fromEntries(STAGES.map((s) => [s, sinceBeacon[s].dump()]));
+      STAGES.forEach((s) => sinceBeacon[s].reset());
+      return send(beacon, JSON.stringify({ client: CLIENT, ts: Date.now(), stages }));
+    },
+    stop: () => clearInterval(timer),
+  };
+
+  if (beacon) {
+    t.enable("beacon", true);
+    timer = setInterval(t.flush, beaconMs);
+    if (typeof window !== "undefined") window.addEventListener("pagehide", t.flush);
+  }
+  return t;
+}
+
+export const tickLatency = createTickLatency({ beacon: process.env.REACT_APP_LATENCY_BEACON || "" });
@@ -0,0 +1,52 @@
+import { createTickLatency } from './tickLatency';
+import { createHistogram } from './histogram';
+
+const dumpOf = (...values) => {
+  const h = createHistogram();
+  values.forEach((v) => h.record(v));
+  return h.dump();
+};
+
+test('stages from the worker, the commit and the next frame add up to tick-to-paint', () => {
+  let t = 0;
+  const frames = [];
+  const lat = createTickLatency({ now: () => t, raf: (cb) => frames.push(cb) });
+  const stage = (name) => lat.snapshot().find((r) => r.stage === name);
+
+  lat.pushed({ pushed: 1000, origins: [0], stages: { network: dumpOf(40) } });
+  expect(stage('network').n).toBe(0); // disabled: nothing kept
+  const toggles = [];
+  lat.onEnabled((on) => toggles.push(on));
+  lat.enable('overlay', true);
+
+  lat.pushed({ pushed: 1000, origins: [100, 600], stages: { network: dumpOf(40, 50), decode: dumpOf(5), conflation: dumpOf(900, 400) } });
+  t = 1700;
+  lat.committed();
+  lat.committed(); // an unrelated render does not count twice
+  t = 1716;
+  frames.shift()();
+  expect(stage('network').n).toBe(2);
+  expect(stage('commit').lat[0]).toBe(700);
+  expect(stage('paint').lat[0]).toBe(16);
+  expect(stage('total')).toMatchObject({ n: 2, max: 1616 }); // one per symbol shown, from its own origin
+  expect(frames).toHaveLength(0);
+
+  lat.enable('overlay', false);
+  expect(toggles).toEqual([true, false]);
+});
+
+test('the beacon sends what was recorded since the previous one', () => {
+  const sent = [];
+  let t = 0;
+  const lat = createTickLatency({ now: () => t, raf: (cb) => cb(), beacon: '/latency', beaconMs: 1e9, send: (url, body) => sent.push(JSON.parse(body)) });
+  expect(lat.enabled()).toBe(true);
+  expect(lat.flush()).toBe(false); // nothing painted yet
+  lat.pushed({ pushed: 0, origins: [0, 0, 0], stages: {} });
+  t = 2000;
+  lat.committed();
+  lat.flush();
+  expect(sent).toHaveLength(1);
+  expect(sent[0].stages.total).toMatchObject({ n: 3, max: 2000 });
+  expect(lat.flush()).toBe(false);
+  lat.stop();
+});
@@ -0,0 +1,145 @@
+import React, { useCallback, useEffect, useRef } from "react";
+import { nearestIndex } from "./seriesStore";
+
+/**
+ * Shared time cursor (synchronized crosshair for every time-series card)
+ * - One delegated pointermove handler on the grid records the latest pointer position
+ * - Once per frame: one layout read (the hovered layer's rect) → hovered time, then every
+ *   registered chart binary-searches its own columnar timestamps and moves its crosshair
+ * - Crosshairs live on an overlay layer and are written through style/textContent only,
+ *   so the charts underneath never re-render on hover
+ */
+
+export function createTimeCursor() {
+  const charts = new Map(); // id -> { el, line, label, cfg, width }
+  let pending = null; // { id, clientX } | null (pointer left)
+  let raf = 0;
+  let shown = false;
+  let lastFrameMs = 0;
+  const ro =
+    typeof ResizeObserver === "function"
+      ? new ResizeObserver((entries) =>
+          entries.forEach((e) => {
+            const c = charts.get(e.target.dataset.layer);
+            if (c) c.width = e.contentRect.width;
+          })
+        )
+      : null;
+
+  const hide = (c) => {
+    c.el.style.visibility = "hidden";
+  };
+
+  const draw = (c, t) => {
+    const { series, field, inset, domain, format } = c.cfg.current;
+    const [t0, t1] = domain();
+    const i = nearestIndex(series, t);
+    if (i < 0 || t1 <= t0 || t < t0 || t > t1) return hide(c);
+    const { left, right } = inset(c.width);
+    const ti = series.t[i];
+    const x = left + ((ti - t0) / (t1 - t0)) * (c.width - left - right);
+    c.line.style.transform = `translateX(${x}px)`;
+    c.label.style.transform = `translateX(${Math.min(x + 8, c.width - 120)}px)`;
+    c.label.textContent = format(ti, series.cols[field][i]);
+    c.el.style.visibility = "visible";
+  };
+
+  const frame = () => {
+    raf = 0;
+    const start = performance.now();
+    const src = pending && charts.get(pending.id);
+    if (!src) {
+      if (shown) charts.forEach(hide);
+      shown = false;
+      return;
+    }
+    const rect = src.el.getBoundingClientRect();
+    const { inset, domain } = src.cfg.current;
+    const { left, right } = inset(rect.width);
+    const [t0, t1] = domain();
+    const frac = (pending.clientX - rect.left - left) / (rect.width - left - right);
+    if (frac < 0 || frac > 1) {
+      charts.forEach(hide);
+    } else {
+      const t = t0 + frac * (t1 - t0);
+      charts.forEach((c) => draw(c, t));
+    }
+    shown = true;
+    lastFrameMs = performance.now() - start;
+  };
+
+  const schedule = () => {
+    if (!raf) raf = requestAnimationFrame(frame);
+  };
+
+  return {
+    register(id, el, cfg) {
+      el.dataset.layer = id;
+      const c = { el, line: el.querySelector("[data-cursor-line]"), label: el.querySelector("[data-cursor-label]"), cfg, width: el.clientWidth };
+      charts.set(id, c);
+      if (ro) ro.observe(el);
+      return () => {
+        if (ro) ro.unobserve(el);
+        if (charts.get(id) === c) charts.delete(id);
+      };
+    },
+    // pointer handlers only record; all work happens in the next frame
+    move(id, clientX) {
+      pending = { id, clientX };
+      schedule();
+    },
+    leave() {
+      pending = null;
+      schedule();
+    },
+    getStats: () => ({ charts: charts.size, lastFrameMs }),
+  };
+}
+
+export const timeCursor = createTimeCursor();
+
+// ---------- hooks / components
+// Ref callback for the grid container: the single pointer handler for all charts.
+export function useTimeCursorRoot(cursor = timeCursor) {
+  const cleanup = useRef(null);
+  return useCallback(
+    (el) => {
+      if (cleanup.current) cleanup.current();
+      cleanup.current = null;
+      if (!el) return;
+      const onMove = (e) => {
+        const host = e.target.closest && e.target.closest("[data-cursor-id]");
+        if (host) cursor.move(host.dataset.cursorId, e.clientX);
+        else cursor.leave();
+      };
+      const onLeave = () => cursor.leave();
+      el.addEventListener("pointermove", onMove, { passive: true });
+      el.addEventListener("pointerleave", onLeave, { passive: true });
+      cleanup.current = () => {
+        el.removeEventListener("pointermove", onMove);
+        el.removeEventListener("pointerleave", onLeave);
+      };
+    },
+    [cursor]
+  );
+}
+
+const fmtDay = (t) => new Date(t).toLocaleDateString(undefined, { month: "short", day: "numeric" });
+export const formatCursor = (t, v) => `${fmtDay(t)} · ${v.toLocaleString(undefined, { maximumFractionDigits: 2 })}`;
+
+/**
+ * Overlay for one chart. Place inside a `relative` wrapper that carries data-cursor-id={id}.
+ * inset(width) -> { left, right }: plot-area padding in px; domain() -> [t0, t1] in ms.
+ */
+export function CursorLayer({ id, series, field, inset, domain, format = formatCursor, cursor = timeCursor }) {
+  const ref = useRef(null);
+  const cfg = useRef(null);
+  cfg.current = { series, field, inset, domain, format };
+  useEffect(() => cursor.register(id, ref.current, cfg), [id, cursor]);
+  return (
+    <div ref={ref} className="absolute inset-0 pointer-events-none" style={{ visibility: "hidden" }}>
+      <div data-cursor-line className="absolute top-0 bottom-6 left-0 w-px bg-slate-300/40" />
+      <div data-cursor-label className="absolute top-0 left-0 px-2 py-1 rounded-lg text-xs whitespace-nowrap bg-slate-950/90 border border-white/10 text-slate-200" />
+    </div>
+  );
+}
@@ -0,0 +1,82 @@
+/**
+ * Web vitals beacon
+ * - reportWebVitals() feeds CLS / FID / FCP / LCP / TTFB from web-vitals, plus INP from an `event`
+ *   PerformanceObserver (web-vitals 2.x predates INP), into a batching sender
+ * - Each entry is tagged with the build and the role / route current when it was measured, so the
+ *   login -> dashboard path can be split out; the payload is { b, s, e: [[name, value, role, route], ...] }
+ * - App.js adds LTD: login accepted -> the dashboard's first frame
+ * - Sent with sendBeacon once maxBatch entries are queued and on pagehide / hidden, which is when
+ *   CLS, LCP and INP are final
+ * - Off unless REACT_APP_VITALS_BEACON is set; scripts/beacon-collector.js aggregates the batches
+ */
+
+const SESSION = Math.random().toString(36).slice(2, 10);
+
+// CLS is unitless; everything else is ms
+const round = (name, v) => (name === "CLS" ? Math.round(v * 10000) / 10000 : Math.round(v * 10) / 10);
+
+export function createVitalsBeacon({ url, build = "dev", maxBatch = 20, send = (u, body) => navigator.sendBeacon(u, body) }) {
+  let queue = [];
+  let ctx = { role: "", route: "" };
+
+  const b = {
+    // role / route the next entries are tagged with
+    setContext(patch) {
+      ctx = { ...ctx, ...patch };
+    },
+    // web-vitals metric shape: { name, value }
+    report({ name, value }) {
+      queue.push([name, round(name, value), ctx.role, ctx.route]);
+      if (queue.length >= maxBatch) b.flush();
+    },
+    flush() {
+      if (!queue.length) return false;
+      const body = JSON.stringify({ b: build, s: SESSION, e: queue });
+      queue = [];
+      return send(url, body);
+    },
+    pending: () => queue.length,
+  };
+  return b;
+}
+
+// INP: the worst interaction, or the 98th percentile once there are 50+ of them (one outlier
+// forgiven per 50, as web-vitals 3 does); `durations` holds one value per interactionId
+export function estimateINP(durations) {
+  if (!durations.length) return 0;
+  const worst = durations.slice().sort((a, b) => b - a);
+  return worst[Math.min(Math.floor(durations.length / 50), worst.length - 1)];
+}
+
+// Reports INP through onReport({ name: "INP", value }) whenever the page is hidden; returns a stop fn
+export function observeINP(onReport) {
+  if (typeof PerformanceObserver === "undefined" || !(PerformanceObserver.supportedEntryTypes || []).includes("event")) return () => {};
+  const byInteraction = new Map(); // interactionId -> longest event duration
+  const observer = new PerformanceObserver((list) => {
+    list.getEntries().forEach((e) => {
+      if (e.interactionId) byInteraction.set(e.interactionId, Math.max(e.duration, byInteraction.get(e.interactionId) || 0));
+    });
+  });
+  observer.observe({ type: "event", durationThreshold: 16, buffered: true });
+  let reported = 0;
+  const onHidden = () => {
+    if (document.visibilityState !== "hidden" || byInteraction.size === reported) return;
+    reported = byInteraction.size;
+    onReport({ name: "INP", value: estimateINP([...byInteraction.values()]) });
+  };
+  document.addEventListener("visibilitychange", onHidden, true);
+  return () => {
+    observer.disconnect();
+    document.removeEventListener("visibilitychange", onHidden, true);
+  };
+}
+
+export const vitals = process.env.REACT_APP_VITALS_BEACON
+  ? createVitalsBeacon({ url: process.env.REACT_APP_VITALS_BEACON, build: process.env.REACT_APP_BUILD || "dev" })
+  : null;
+
+if (vitals) {
+  // pagehide covers bfcache and mobile tab kills; visibilitychange the ordinary tab switch
+  window.addEventListener("pagehide", vitals.flush);
+  document.addEventListener("visibilitychange", () => document.visibilityState === "hidden" && vitals.flush());
+}
@@ -0,0 +1,33 @@
+import { createVitalsBeacon, estimateINP } from './vitals';
+
+test('entries are tagged with the context they were measured in and sent in batches', () => {
+  const sent = [];
+  const beacon = createVitalsBeacon({ url: '/vitals', build: 'abc123', maxBatch: 3, send: (url, body) => sent.push([url, JSON.parse(body)]) });
+  expect(beacon.flush()).toBe(false);
+  beacon.setContext({ role: 'Admin', route: '/login' });
+  beacon.report({ name: 'FCP', value: 412.345 });
+  beacon.report({ name: 'CLS', value: 0.123456 });
+  beacon.setContext({ route: '/dashboard' });
+  beacon.report({ name: 'LTD', value: 250 });
+  expect(sent).toHaveLength(1);
+  expect(sent[0][0]).toBe('/vitals');
+  expect(sent[0][1]).toMatchObject({
+    b: 'abc123',
+    e: [
+      ['FCP', 412.3, 'Admin', '/login'],
+      ['CLS', 0.1235, 'Admin', '/login'],
+      ['LTD', 250, 'Admin', '/dashboard'],
+    ],
+  });
+  beacon.report({ name: 'INP', value: 96 });
+  expect(beacon.pending()).toBe(1);
+  beacon.flush(); // pagehide
+  expect(sent).toHaveLength(2);
+});
+
+test('INP is the worst interaction, forgiving one outlier per 50', () => {
+  expect(estimateINP([])).toBe(0);
+  expect(estimateINP([40, 300, 120])).toBe(300);
+  const many = Array.from({ length: 100 }, (_, i) => i + 1);
+  expect(estimateINP(many)).toBe(98);
+});
@@ -0,0 +1,66 @@
+import { decodeSnapshot, SNAPSHOT_KEY } from "./snapshot";
+import { idbGet } from "./idb";
+import { fetchCache } from "./fetchCache";
+import { entityStore } from "./entityStore";
+import { spawnSnapshotWorker } from "./workers";
+
+/**
+ * Warm start: the dashboard's last-known state, back in memory before the first render
+ * - load() (index.js, next to prefs.load) reads the binary snapshot (snapshot.js) from IndexedDB
+ *   and primes what the first frame reads: history series into fetchCache (served at once and
+ *   revalidated by the first read), portfolio entities into the entity store (refetched in the
+ *   background) and last prices, which usePriceFeed and the feed worker start from
+ * - start() saves a snapshot every SAVE_MS while the dashboard is shown and whenever the page is
+ *   hidden; the encode and the write run in snapshot.worker.js
+ * - Snapshots older than MAX_AGE_MS are ignored; layout and theme are prefs.js's
+ */
+
+const SAVE_MS = 5000;
+const MAX_AGE_MS = 24 * 3600 * 1000;
+const ENTITY_TYPES = ["account", "position", "instrument"];
+
+let restored = null;
+let loading = null;
+let worker;
+
+function restore(buf) {
+  const snap = decodeSnapshot(buf);
+  if (!snap || Date.now() - snap.savedAt > MAX_AGE_MS) return;
+  restored = snap;
+  Object.keys(snap.series).forEach((key) => fetchCache.prime(key, snap.series[key]));
+  if (snap.entities) {
+    entityStore.merge(snap.entities);
+    Object.keys(snap.entities).forEach((type) => entityStore.refresh(type, snap.entities[type].map((e) => e.id)));
+  }
+}
+
+export const warmStart = {
+  // resolves once restored, or after `timeout` ms: a cold first frame beats a late one
+  load({ timeout = 300 } = {}) {
+    // a snapshot that can't be read or restored is a cold start, never a blocked first render
+    if (!loading) loading = idbGet("cache", SNAPSHOT_KEY).then(restore).catch(() => {});
+    return Promise.race([loading, new Promise((r) => setTimeout(r, timeout))]);
+  },
+  restored: () => restored !== null,
+  prices: () => (restored ? restored.prices : {}),
+  // prices(): the latest pushed prices; history: fetchCache keys of the series on screen
+  start({ prices, history }) {
+    if (worker === undefined) worker = spawnSnapshotWorker();
+    if (!worker) return () => {};
+    const save = () => {
+      const series = {};
+      history.forEach((key) => {
+        const s = fetchCache.peek(key);
+        if (s) series[key] = s;
+      });
+      worker.postMessage({ type: "save", state: { savedAt: Date.now(), prices: prices(), series, entities: entityStore.dump(ENTITY_TYPES) } });
+    };
+    const onHidden = () => document.visibilityState === "hidden" && save();
+    const id = setInterval(save, SAVE_MS);
+    document.addEventListener("visibilitychange", onHidden);
+    return () => {
+      clearInterval(id);
+      document.removeEventListener("visibilitychange", onHidden);
+    };
+  },
+};
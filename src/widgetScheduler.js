@@ -0,0 +1,168 @@
+import { useEffect, useRef, useState } from "react";
+import { flushSync } from "react-dom";
+
+/**
+ * Cooperative widget update scheduler
+ * - One pending update per widget (latest value wins), bucketed by priority
+ * - Drains highest priority first, time-sliced so script per frame stays under frameBudgetMs
+ * - Yields on isInputPending() and via scheduler.postTask (MessageChannel fallback); the flush task
+ *   runs at the top pending priority, and a more urgent post re-posts it (the older task is dropped)
+ * - Each task commits its widget synchronously (flushSync) so the render cost is measured
+ *   inside the slice; tasks over their own budget are counted and emitted as performance.measure
+ */
+
+export const PRIORITY = { FOCUSED: 0, VISIBLE: 1, BACKGROUND: 2, OFFSCREEN: 3 };
+const POST_TASK_PRIORITY = ["user-blocking", "user-visible", "background", "background"];
+const postTaskRank = (p) => POST_TASK_PRIORITY.indexOf(POST_TASK_PRIORITY[p]); // 0 = most urgent
+
+const hasPostTask = () => typeof globalThis.scheduler === "object" && typeof globalThis.scheduler.postTask === "function";
+const inputPending = () => {
+  const s = typeof navigator !== "undefined" && navigator.scheduling;
+  return !!(s && s.isInputPending && s.isInputPending());
+};
+
+export function createWidgetScheduler({ frameBudgetMs = 8, widgetBudgetMs = 4 } = {}) {
+  const buckets = Object.values(PRIORITY).map(() => new Map()); // priority -> (id -> task)
+  const stats = new Map(); // id -> { runs, totalMs, maxMs, overruns }
+  let posted = null; // { rank } of the flush task in the queue
+  let frameWait = false; // frame budget spent: flush again after the next rAF
+  let frameSpent = 0;
+  let frameRaf = 0;
+  let channel = null;
+
+  const statFor = (id) => {
+    let s = stats.get(id);
+    if (!s) stats.set(id, (s = { runs: 0, totalMs: 0, maxMs: 0, overruns: 0 }));
+    return s;
+  };
+
+  const topPriority = () => buckets.findIndex((b) => b.size > 0);
+
+  // script time is accounted per frame; the counter resets on the next rAF
+  const trackFrame = () => {
+    if (frameRaf) return;
+    frameRaf = requestAnimationFrame(() => {
+      frameRaf = 0;
+      frameSpent = 0;
+    });
+  };
+
+  const schedule = (afterFrame) => {
+    if (frameWait) return;
+    const p = topPriority();
+    if (p < 0) return;
+    if (afterFrame) {
+      frameWait = true;
+      requestAnimationFrame(() => {
+        frameSpent = 0;
+        frameWait = false;
+        schedule(false);
+      });
+    } else if (hasPostTask()) {
+      const rank = postTaskRank(p);
+      if (posted && posted.rank <= rank) return;
+      // the new task supersedes the queued one, which then does nothing
+      const task = { rank };
+      posted = task;
+      globalThis.scheduler.postTask(() => posted === task && flush(), { priority: POST_TASK_PRIORITY[p] });
+    } else {
+      if (posted) return;
+      posted = { rank: 0 };
+      if (!channel) {
+        channel = new MessageChannel();
+        channel.port1.onmessage = flush;
+      }
+      channel.port2.postMessage(null);
+    }
+  };
+
+  const runTask = (id, task) => {
+    const t0 = performance.now();
+    task.fn();
+    const t1 = performance.now();
+    const dur = t1 - t0;
+    const s = statFor(id);
+    s.runs++;
+    s.totalMs += dur;
+    if (dur > s.maxMs) s.maxMs = dur;
+    if (dur > task.budgetMs) {
+      s.overruns++;
+      if (performance.measure) performance.measure(`widget-overrun:${id}`, { start: t0, end: t1 });
+    }
+    return dur;
+  };
+
+  function flush() {
+    posted = null;
+    trackFrame();
+    const start = performance.now();
+    for (let p = topPriority(); p >= 0; p = topPriority()) {
+      const [id, task] = buckets[p].entries().next().value;
+      buckets[p].delete(id);
+      frameSpent += runTask(id, task);
+      if (frameSpent >= frameBudgetMs) return schedule(true);
+      if (inputPending() || performance.now() - start >= frameBudgetMs) return schedule(false);
+    }
+  }
+
+  return {
+    // queue (or replace) the pending update for a widget; returns a cancel fn
+    post(id, fn, { priority = PRIORITY.VISIBLE, budgetMs = widgetBudgetMs } = {}) {
+      buckets.forEach((b) => b.delete(id));
+      const task = { fn, budgetMs };
+      buckets[priority].set(id, task);
+      schedule(false);
+      return () => {
+        if (buckets[priority].get(id) === task) buckets[priority].delete(id);
+      };
+    },
+    pending: () => buckets.reduce((n, b) => n + b.size, 0),
+    getStats: () =>
+      Array.from(stats, ([id, s]) => ({ id, runs: s.runs, avgMs: s.runs ? s.totalMs / s.runs : 0, maxMs: s.maxMs, overruns: s.overruns })),
+    resetStats: () => stats.clear(),
+  };
+}
+
+export const widgetScheduler = createWidgetScheduler();
+
+// ---------- hooks
+// Returns `value` once the scheduler has committed it for this widget.
+export function useScheduledValue(id, value, priority, scheduler = widgetScheduler) {
+  const [committed, setCommitted] = useState(value);
+  useEffect(() => {
+    if (Object.is(value, committed)) return undefined;
+    return scheduler.post(id, () => flushSync(() => setCommitted(value)), { priority });
+  }, [id, value, committed, priority, scheduler]);
+  return committed;
+}
+
+// FOCUSED while hovered/focused, OFFSCREEN while not intersecting the viewport, else `base`.
+export function useWidgetPriority(base = PRIORITY.VISIBLE) {
+  const ref = useRef(null);
+  const [visible, setVisible] = useState(true);
+  const [focused, setFocused] = useState(false);
+  useEffect(() => {
+    const el = ref.current;
+    if (!el) return undefined;
+    const on = () => setFocused(true);
+    const off = () => setFocused(false);
+    el.addEventListener("pointerenter", on);
+    el.addEventListener("pointerleave", off);
+    el.addEventListener("focusin", on);
+    el.addEventListener("focusout", off);
+    let io = null;
+    if (typeof IntersectionObserver === "function") {
+      io = new IntersectionObserver(([entry]) => setVisible(entry.isIntersecting));
+      io.observe(el);
+    }
+    return () => {
+      el.removeEventListener("pointerenter", on);
+      el.removeEventListener("pointerleave", off);
+      el.removeEventListener("focusin", on);
+      el.removeEventListener("focusout", off);
+      if (io) io.disconnect();
+    };
+  }, []);
+  const priority = focused ? PRIORITY.FOCUSED : visible ? base : PRIORITY.OFFSCREEN;
+  return [ref, priority];
+}
@@ -0,0 +1,59 @@
+import React, { useMemo, useRef } from "react";
+import Chart from "react-apexcharts";
+import { useRenderQuality } from "../renderGovernor";
+import { CursorLayer } from "../timeCursor";
+
+// candles drawn at most; longer (imported) histories are merged into wider bars
+const MAX_CANDLES = 600;
+const MAX_CANDLES_LOW = 150;
+
+// `series` is columnar (seriesStore) with o/h/l/c fields; hover uses the shared time cursor
+export default function CandleStick({ id, series }) {
+  const quality = useRenderQuality();
+  const max = quality.detail === "low" ? MAX_CANDLES_LOW : MAX_CANDLES;
+  // plot geometry as laid out by ApexCharts, captured on mount/update (no DOM reads on hover)
+  const geom = useRef({ left: 0, gridWidth: 0, minX: 0, maxX: 0 });
+  // eslint-disable-next-line react-hooks/exhaustive-deps
+  const data = useMemo(() => {
+    const { o, h, l, c } = series.cols;
+    // `step` source candles per bar: first open, highest high, lowest low, last close
+    const step = Math.max(1, Math.ceil(series.length / max));
+    const out = new Array(Math.ceil(series.length / step));
+    for (let i = 0, k = 0; i < series.length; i += step, k++) {
+      const end = Math.min(i + step, series.length);
+      let hi = h[i];
+      let lo = l[i];
+      for (let j = i + 1; j < end; j++) {
+        if (h[j] > hi) hi = h[j];
+        if (l[j] < lo) lo = l[j];
+      }
+      out[k] = { x: series.t[i], y: [o[i], hi, lo, c[end - 1]] };
+    }
+    return [{ data: out }];
+  }, [series, series.version, max]);
+  const capture = (_, { globals }) => {
+    geom.current = { left: globals.translateX, gridWidth: globals.gridWidth, minX: globals.minX, maxX: globals.maxX };
+  };
+  const options = {
+    chart: {
+      type: "candlestick",
+      background: "transparent",
+      toolbar: { show: quality.detail !== "low" },
+      animations: { enabled: quality.chartAnimations },
+      events: { mounted: capture, updated: capture },
+    },
+    tooltip: { enabled: false },
+    xaxis: { type: "datetime", crosshairs: { show: false }, labels: { style: { colors: "#94a3b8" } } },
+    yaxis: { labels: { style: { colors: "#94a3b8" } } },
+    grid: { borderColor: "rgba(255,255,255,.08)" },
+    theme: { mode: "dark" },
+  };
+  const inset = (width) => ({ left: geom.current.left, right: width - geom.current.left - geom.current.gridWidth });
+  const domain = () => [geom.current.minX, geom.current.maxX];
+  return (
+    <div className="relative h-64" data-cursor-id={id}>
+      <Chart options={options} series={data} type="candlestick" height={256} />
+      <CursorLayer id={id} series={series} field="c" inset={inset} domain={domain} />
+    </div>
+  );
+}
@@ -0,0 +1,71 @@
+import React, { useMemo } from "react";
+import { ResponsiveContainer, AreaChart, Area, XAxis, YAxis } from "recharts";
+import { toRows } from "../seriesStore";
+import { CursorLayer } from "../timeCursor";
+
+const fmtDay = (t) => new Date(t).toLocaleDateString(undefined, { month: "short", day: "numeric" });
+// XAxis padding on both sides
+const inset = () => ({ left: 10, right: 10 });
+
+// `series` is columnar (seriesStore); hover is drawn by the shared time cursor
+export default function ChartCard({ id, title, value, delta, series }) {
+  // eslint-disable-next-line react-hooks/exhaustive-deps
+  const data = useMemo(() => toRows(series), [series, series.version]);
+  const domain = () => [series.t[0], series.t[series.length - 1]];
+  return (
+    <div className="rounded-2xl bg-slate-900/80 border border-white/10 p-6 flex flex-col">
+      <div className="flex items-center justify-between mb-2">
+        <div>
+          <div className="text-slate-300 text-base font-medium">{title}</div>
+          <div className="flex items-end gap-3 mt-1">
+            <span className="text-4xl font-bold text-white tabular-nums">{value}</span>
+            <span className={`text-base font-semibold ${delta >= 0 ? "text-emerald-400" : "text-rose-400"}`}>
+              {delta >= 0 ? "↑" : "↓"} {Math.abs(delta).toFixed(2)}%
+            </span>
+          </div>
+        </div>
+        <div className="flex gap-2">
+          <button className="px-3 py-1 rounded-lg bg-slate-800/70 text-slate-300 text-xs font-medium hover:bg-slate-700 transition">Week</button>
+          <button className="px-3 py-1 rounded-lg bg-slate-800/70 text-slate-300 text-xs font-medium hover:bg-slate-700 transition">Month</button>
+        </div>
+      </div>
+      <div className="relative flex-1 min-h-[180px]" data-cursor-id={id}>
+        <ResponsiveContainer width="100%" height="100%">
+          <AreaChart data={data} margin={{ top: 10, right: 0, left: 0, bottom: 0 }}>
+            <defs>
+              <linearGradient id="blue-gradient" x1="0" y1="0" x2="0" y2="1">
+                <stop offset="0%" stopColor="#60a5fa" stopOpacity={0.7} />
+                <stop offset="100%" stopColor="#60a5fa" stopOpacity={0.05} />
+              </linearGradient>
+            </defs>
+            <XAxis
+              dataKey="t"
+              type="number"
+              scale="time"
+              domain={["dataMin", "dataMax"]}
+              tickFormatter={fmtDay}
+              axisLine={false}
+              tickLine={false}
+              tick={{ fill: "#94a3b8", fontSize: 13, fontWeight: 500 }}
+              padding={{ left: 10, right: 10 }}
+            />
+            <YAxis
+              hide
+              domain={["auto", "auto"]}
+            />
+            <Area
+              type="monotone"
+              dataKey="v"
+              stroke="#60a5fa"
+              fill="url(#blue-gradient)"
+              strokeWidth={3}
+              dot={false}
+              activeDot={false}
+            />
+          </AreaChart>
+        </ResponsiveContainer>
+        <CursorLayer id={id} series={series} field="v" inset={inset} domain={domain} />
+      </div>
+    </div>
+  );
+}
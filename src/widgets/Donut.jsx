@@ -0,0 +1,25 @@
+import React from "react";
+import { PieChart, Pie, Cell, ResponsiveContainer, Tooltip, Legend } from "recharts";
+import { useRenderQuality } from "../renderGovernor";
+
+// color palette (Tailwind tokens used via classNames but here for charts)
+const COLORS = ["#60a5fa", "#34d399", "#fbbf24", "#f87171", "#a78bfa"]; // blue, green, amber, red, violet
+
+export default function Donut({ data }) {
+  const quality = useRenderQuality();
+  return (
+    <div className="h-56">
+      <ResponsiveContainer width="100%" height="100%">
+        <PieChart>
+          <Pie data={data} dataKey="pct" nameKey="name" innerRadius={60} outerRadius={90} paddingAngle={2} isAnimationActive={quality.chartAnimations}>
+            {data.map((_, i) => (
+              <Cell key={i} fill={COLORS[i % COLORS.length]} />
+            ))}
+          </Pie>
+          <Legend verticalAlign="bottom" height={36} wrapperStyle={{ color: "#e2e8f0" }} />
+          <Tooltip contentStyle={{ background: "#0f172a", border: "1px solid rgba(255,255,255,.1)", borderRadius: 12, color: "#e2e8f0" }} />
+        </PieChart>
+      </ResponsiveContainer>
+    </div>
+  );
+}
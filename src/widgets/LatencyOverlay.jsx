@@ -0,0 +1,52 @@
+import React, { useEffect, useState } from "react";
+import { tickLatency } from "../tickLatency";
+
+const ms = (us) => (us < 10000 ? (us / 1000).toFixed(1) : Math.round(us / 1000));
+
+// Debug overlay (open the app with ?latency): tick-to-paint stages, refreshed once a second.
+// Tracing runs only while it is mounted (or a beacon is configured).
+export default function LatencyOverlay() {
+  const [rows, setRows] = useState(tickLatency.snapshot);
+  useEffect(() => {
+    tickLatency.enable("overlay", true);
+    const id = setInterval(() => setRows(tickLatency.snapshot()), 1000);
+    return () => {
+      clearInterval(id);
+      tickLatency.enable("overlay", false);
+    };
+  }, []);
+  return (
+    <div className="fixed bottom-3 right-3 z-50 p-3 rounded-xl bg-slate-900/90 border border-slate-700 text-xs font-mono text-slate-200 shadow-lg">
+      <div className="flex items-center justify-between gap-4 mb-1 text-slate-400">
+        <span>tick → paint (ms)</span>
+        <button className="hover:text-slate-200" onClick={() => setRows((tickLatency.reset(), tickLatency.snapshot()))}>
+          reset
+        </button>
+      </div>
+      <table>
+        <thead className="text-slate-500">
+          <tr>
+            <th className="text-left pr-3 font-normal">stage</th>
+            <th className="text-right pr-3 font-normal">p50</th>
+            <th className="text-right pr-3 font-normal">p99</th>
+            <th className="text-right pr-3 font-normal">p999</th>
+            <th className="text-right font-normal">n</th>
+          </tr>
+        </thead>
+        <tbody>
+          {rows.map(({ stage, n, lat }) => (
+            <tr key={stage} className={stage === "total" ? "text-emerald-400" : ""}>
+              <td className="pr-3">{stage}</td>
+              {[0, 1, 2].map((i) => (
+                <td key={i} className="text-right pr-3">
+                  {lat ? ms(lat[i]) : "–"}
+                </td>
+              ))}
+              <td className="text-right">{n}</td>
+            </tr>
+          ))}
+        </tbody>
+      </table>
+    </div>
+  );
+}
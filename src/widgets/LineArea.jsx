@@ -0,0 +1,40 @@
+import React, { useMemo } from "react";
+import { ResponsiveContainer, AreaChart, Area, XAxis, YAxis, CartesianGrid } from "recharts";
+import { useRenderQuality } from "../renderGovernor";
+import { toRows } from "../seriesStore";
+import { CursorLayer } from "../timeCursor";
+
+const fmtDay = (t) => new Date(t).toLocaleDateString(undefined, { month: "short", day: "numeric" });
+
+// plot-area padding: YAxis width on the left, chart margin on the right
+const INSET = { left: 40, right: 10 };
+const inset = () => INSET;
+
+// `series` is columnar (seriesStore); hover is drawn by the shared time cursor, not a Tooltip
+export default function LineArea({ id, series }) {
+  const quality = useRenderQuality();
+  const low = quality.detail === "low";
+  // series.version: appends mutate in place
+  // eslint-disable-next-line react-hooks/exhaustive-deps
+  const points = useMemo(() => toRows(series, low ? 8 : Infinity), [series, series.version, low]);
+  const domain = () => [series.t[0], series.t[series.length - 1]];
+  return (
+    <div className="relative h-40" data-cursor-id={id}>
+      <ResponsiveContainer width="100%" height="100%">
+        <AreaChart data={points} margin={{ top: 10, right: INSET.right, left: 0, bottom: 0 }}>
+          <defs>
+            <linearGradient id="g" x1="0" y1="0" x2="0" y2="1">
+              <stop offset="0%" stopColor="#34d399" stopOpacity={0.6} />
+              <stop offset="100%" stopColor="#34d399" stopOpacity={0} />
+            </linearGradient>
+          </defs>
+          {!low && <CartesianGrid stroke="rgba(255,255,255,.06)" vertical={false} />}
+          <XAxis dataKey="t" type="number" scale="time" domain={["dataMin", "dataMax"]} tickFormatter={fmtDay} tick={{ fill: "#94a3b8", fontSize: 12 }} tickLine={false} axisLine={false} />
+          <YAxis tick={{ fill: "#94a3b8", fontSize: 12 }} tickLine={false} axisLine={false} width={INSET.left} />
+          <Area type={low ? "linear" : "monotone"} dataKey="v" stroke="#34d399" fill={low ? "none" : "url(#g)"} strokeWidth={2} activeDot={false} isAnimationActive={quality.chartAnimations} />
+        </AreaChart>
+      </ResponsiveContainer>
+      <CursorLayer id={id} series={series} field="v" inset={inset} domain={domain} />
+    </div>
+  );
+}
@@ -0,0 +1,48 @@
+import React, { memo, useState } from "react";
+import { Search } from "lucide-react";
+import { useNews } from "../news";
+
+// Headline stream + local full-text search (index lives in news.worker.js).
+const fmtTime = (ts) => new Date(ts).toLocaleTimeString(undefined, { hour: "2-digit", minute: "2-digit" });
+
+const Headline = memo(function Headline({ item, onTicker, selected }) {
+  return (
+    <li className="py-2 border-t border-white/5 first:border-t-0">
+      <div className="text-sm text-slate-200 leading-snug">{item.title}</div>
+      <div className="mt-1 flex items-center gap-2 text-xs text-slate-400">
+        <span>{fmtTime(item.ts)}</span>
+        <span>· {item.source}</span>
+        {item.tickers.map((sym) => (
+          <button
+            key={sym}
+            onClick={() => onTicker(sym)}
+            className={`px-1.5 py-0.5 rounded-md border ${sym === selected ? "border-indigo-400 text-indigo-200 bg-indigo-500/20" : "border-white/10 text-slate-300 hover:bg-slate-800"}`}
+          >
+            {sym}
+          </button>
+        ))}
+      </div>
+    </li>
+  );
+});
+
+export default function NewsPane({ tickers, onTicker, selected }) {
+  const [query, setQuery] = useState("");
+  const { items, total, tookMs, docs, searching } = useNews(query, tickers);
+  return (
+    <div className="flex flex-col h-72">
+      <div className="flex items-center gap-2 bg-slate-800/60 rounded-xl px-3 py-2">
+        <Search className="w-4 h-4 text-slate-400" />
+        <input value={query} onChange={(e) => setQuery(e.target.value)} placeholder="Search headlines" className="bg-transparent outline-none text-sm flex-1" />
+      </div>
+      <div className="mt-2 text-xs text-slate-500">
+        {searching ? `${total.toLocaleString()} matches · ${tookMs.toFixed(1)} ms` : "Latest"} · {docs.toLocaleString()} indexed
+      </div>
+      <ul className="mt-1 flex-1 overflow-y-auto pr-1">
+        {items.map((item) => (
+          <Headline key={item.id} item={item} onTicker={onTicker} selected={selected} />
+        ))}
+      </ul>
+    </div>
+  );
+}
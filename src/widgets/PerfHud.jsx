@@ -0,0 +1,35 @@
+import React from "react";
+import { usePerfHud } from "../perfHud";
+
+const mb = (b) => `${(b / 1048576).toFixed(0)} MB`;
+
+// Admin performance HUD, opened from Topbar's Settings icon. One small render per second while
+// open; unmounting stops every sampler it started (see perfHud.js).
+export default function PerfHud({ onClose }) {
+  const s = usePerfHud();
+  const row = (label, value, warn) => (
+    <div key={label} className="flex justify-between gap-6">
+      <span className="text-slate-400">{label}</span>
+      <span className={warn ? "text-amber-400" : "text-slate-100"}>{value}</span>
+    </div>
+  );
+  return (
+    <div className="fixed top-16 right-4 z-50 w-64 p-3 rounded-xl bg-slate-900/95 border border-slate-700 text-xs font-mono shadow-lg">
+      <div className="flex items-center justify-between mb-2 text-slate-300">
+        <span>Performance</span>
+        <button className="text-slate-400 hover:text-slate-100" onClick={onClose} aria-label="Close performance HUD">
+          ×
+        </button>
+      </div>
+      {row("FPS", s.fps, s.fps && s.fps < 50)}
+      {row("Janky frames", `${Math.round(s.jank * 100)}%`, s.jank > 0.1)}
+      {row("Long tasks", `${s.longTasks} · ${s.longTaskMs}ms`, s.longTaskMs > 50)}
+      {row("JS heap", s.heap ? `${mb(s.heap.used)} / ${mb(s.heap.limit)}` : "–")}
+      {row("Feed ticks in / rendered", `${s.ticksIn} / ${s.rendered} /s`)}
+      <div className="mt-2 mb-1 text-slate-500">Worker queues</div>
+      {s.queues.length ? s.queues.map((q) => row(q.name, q.depth, q.depth > 2)) : row("–", "")}
+      <div className="mt-2 mb-1 text-slate-500">Commits / s</div>
+      {s.commits.length ? s.commits.map((c) => row(c.id, c.perSec)) : row("–", "")}
+    </div>
+  );
+}
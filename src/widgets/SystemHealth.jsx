@@ -0,0 +1,65 @@
+import React from "react";
+import { useCacheStats } from "../fetchCache";
+import { useTelemetry, HISTORY } from "../telemetry";
+
+const pct = (r) => (r == null ? "–" : `${Math.round(r * 100)}%`);
+const ms = (us) => (us == null ? "–" : us < 10000 ? `${(us / 1000).toFixed(1)}ms` : `${Math.round(us / 1000)}ms`);
+const lat = (l) => (l ? `${ms(l[0])} / ${ms(l[1])} / ${ms(l[2])}` : "–");
+const WS_LABEL = { mock: "Mock feed", connecting: "Connecting", open: "Yes", closed: "No" };
+
+// last HISTORY samples as a polyline; gaps (null) are skipped
+function Sparkline({ values }) {
+  const nums = values.filter((v) => v != null);
+  if (nums.length < 2) return <svg className="w-full h-6 mt-1" />;
+  const max = Math.max(...nums) || 1;
+  const min = Math.min(...nums, 0);
+  const pts = values
+    .map((v, i) => (v == null ? null : `${((HISTORY - values.length + i) / (HISTORY - 1)) * 100},${24 - ((v - min) / (max - min || 1)) * 22 - 1}`))
+    .filter(Boolean)
+    .join(" ");
+  return (
+    <svg className="w-full h-6 mt-1" viewBox="0 0 100 24" preserveAspectRatio="none">
+      <polyline points={pts} fill="none" stroke="currentColor" strokeWidth="1.5" vectorEffect="non-scaling-stroke" className="text-emerald-400/70" />
+    </svg>
+  );
+}
+
+function Tile({ label, value, title, series, warn }) {
+  return (
+    <div className="p-3 rounded-xl bg-slate-800/60" title={title}>
+      {label}: <span className={warn ? "text-amber-400" : "text-emerald-400"}>{value}</span>
+      {series && <Sparkline values={series} />}
+    </div>
+  );
+}
+
+// Admin-only card; kept in its own chunk so other roles never load it.
+// Live values from telemetry.js, sampled at 1 Hz only while this card is mounted.
+export default function SystemHealth() {
+  const cache = useCacheStats();
+  const t = useTelemetry();
+  const gw = t.ws !== "mock";
+  return (
+    <div className="grid grid-cols-2 gap-4 text-sm">
+      <Tile label="API Latency" value={lat(t.api)} title="p50 / p99 / p999 of REST round trips" series={t.series.api} />
+      <Tile label="WS Connected" value={WS_LABEL[t.ws]} warn={t.ws === "closed" || t.ws === "connecting"} title={gw ? "server/gateway WebSocket" : "no REACT_APP_GATEWAY_URL; prices come from the in-browser walk"} />
+      <Tile label="Feed Latency" value={lat(t.feed)} title="gateway ingest -> feed worker, p50 / p99 / p999" series={t.series.feed} />
+      <Tile label="Fan-out" value={lat(t.fanout)} title="gateway ingest -> socket write, p50 / p99 / p999" series={t.series.fanout} />
+      <Tile label="Msg Rate" value={`${t.rate}/s`} title="ticks received by this client" series={t.series.rate} />
+      <Tile
+        label="Conflated"
+        value={`${t.conflated}/s`}
+        warn={t.dropped > 0}
+        title={`ticks superseded before reaching the screen${gw ? ` · ${t.dropped} slow clients dropped by the gateway` : ""}`}
+        series={t.series.conflated}
+      />
+      <Tile
+        label="Cache Hits"
+        value={pct(cache.hitRatio)}
+        title={`${cache.hits} hits · ${cache.deduped} deduped · ${cache.misses} misses · ${cache.stale} stale · ${(cache.bytes / 1024).toFixed(0)} KB in ${cache.entries} entries`}
+        series={t.series.hitRatio}
+      />
+      <Tile label="Users Online" value={t.users == null ? "–" : t.users} title="clients connected to the gateway" series={t.series.users} />
+    </div>
+  );
+}
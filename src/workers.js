@@ -0,0 +1,17 @@
+/**
+ * Worker entry points. Kept together so webpack sees the `new URL(..., import.meta.url)`
+ * pattern in one place and tests can swap this module for a stub.
+ * Every spawner returns null where workers are unavailable; callers fall back to the main thread.
+ */
+
+const canSpawn = () => typeof Worker === "function";
+export { canSpawn as canSpawnWorkers };
+
+export const spawnGridLayoutWorker = () => (canSpawn() ? new Worker(new URL("./gridLayout.worker.js", import.meta.url)) : null);
+export const spawnInstrumentSearchWorker = () => (canSpawn() ? new Worker(new URL("./instrumentSearch.worker.js", import.meta.url)) : null);
+export const spawnNewsWorker = () => (canSpawn() ? new Worker(new URL("./news.worker.js", import.meta.url)) : null);
+export const spawnFeedWorker = () => (canSpawn() ? new Worker(new URL("./feed.worker.js", import.meta.url)) : null);
+export const spawnSnapshotWorker = () => (canSpawn() ? new Worker(new URL("./snapshot.worker.js", import.meta.url)) : null);
+export const spawnCandleImportWorker = () => (canSpawn() ? new Worker(new URL("./candleImport.worker.js", import.meta.url)) : null);
+// one instance per origin, shared by every tab (feedHub.js); named so all tabs attach to the same one
+export const spawnSharedFeedWorker = () => (typeof SharedWorker === "function" ? new SharedWorker(new URL("./feed.worker.js", import.meta.url), { name: "fs-feed" }) : null);